@@ -0,0 +1,307 @@
+///////////////////////////////////////////////////////////////////////////////
+// cllist.c
+// Compact linked list implementation in C99. Nodes live in one growable 
+// array and link to each other through 32-bit indices, so the whole list can 
+// be relocated and each node only carries 8 bytes of links. Elements are 
+// aligned as any type of their size could need, up to LLIST_ARENA_ALIGN, or 
+// to an alignment given at initialisation. 
+//
+// Author: agent
+// Date:   17/10/2026
+///////////////////////////////////////////////////////////////////////////////
+
+#include "cllist.h"
+
+// Offset of the element in a node, the links padded to the alignment. 
+#define CNODE_DATA(l) ((sizeof(clink_t) + (l)->align - 1) & ~((l)->align - 1))
+
+static int cnode_grow(cllist_t *l, uint32_t cap);
+static inline clink_t *cnode_link(const cllist_t *l, uint32_t n);
+static inline void *cnode_data(const cllist_t *l, uint32_t n);
+static uint32_t cnode_new(cllist_t *l, const void *d);
+static uint32_t cnode_get(const cllist_t *l, size_t i);
+
+// Initialises the specified compact linked list. 
+//
+// PARAMS: 
+// l    - the compact linked list to initialise
+// elem - the size of every element
+//
+// RET: 
+// Zero on success, non-zero on error. 
+int cllist_init(cllist_t *l, size_t elem) {
+    size_t align = elem & (~elem + 1);      // lowest set bit of elem
+    align = (align > LLIST_ARENA_ALIGN) ? LLIST_ARENA_ALIGN : align;
+    return cllist_init_align(l, elem, align);
+}
+
+// Initialises the specified compact linked list, aligning every element to 
+// the given alignment. The element follows the links of its node, padded to 
+// the alignment, and the node array is aligned within its allocation. 
+//
+// PARAMS: 
+// l     - the compact linked list to initialise
+// elem  - the size of every element
+// align - the alignment of every element, a power of two
+//
+// RET: 
+// Zero on success, non-zero on error. 
+int cllist_init_align(cllist_t *l, size_t elem, size_t align) {
+    if (l == NULL || elem == 0 || align == 0 || (align & (align - 1)) != 0)
+        return LLIST_NULL_ERR;
+
+    align = (align < sizeof(uint32_t)) ? sizeof(uint32_t) : align;
+    l->block = NULL;
+    l->nodes = NULL;
+    l->head = CLLIST_NIL;
+    l->tail = CLLIST_NIL;
+    l->free = CLLIST_NIL;
+    l->cap = 0;
+    l->len = 0;
+    l->elem = elem;
+    l->align = align;
+    l->stride = (CNODE_DATA(l) + elem + align - 1) & ~(align - 1);
+    return LLIST_OK;
+}
+
+// Returns the element at the given index in the specified compact linked 
+// list. If the index is out of range, then the last element will be returned. 
+// The element may move when the list grows. 
+//
+// PARAMS: 
+// l - the compact linked list to retrieve the element
+// i - the index of the element
+//
+// RET: 
+// The element at the given index, or NULL if any error occurred. 
+void *cllist_get(const cllist_t *l, size_t i) {
+    uint32_t node = cnode_get(l, i);
+    void *ret = NULL;
+    if (node != CLLIST_NIL)
+        ret = cnode_data(l, node);
+    return ret;
+}
+
+// Add a new element into the given compact linked list. The element will be 
+// stored as a copy. 
+//
+// PARAMS: 
+// l - the compact linked list to have the element added
+// d - the element to add
+//
+// RET: 
+// Zero on success, non-zero on error. 
+int cllist_add(cllist_t *l, const void *d) {
+    if (l == NULL || d == NULL)
+        return LLIST_NULL_ERR;
+
+    uint32_t add = cnode_new(l, d);
+    if (add == CLLIST_NIL)
+        return LLIST_ALLOC_ERR;
+
+    clink_t *link = cnode_link(l, add);
+    link->prev = l->tail;
+    link->next = CLLIST_NIL;
+    if (l->len == 0)            // list is empty
+        l->head = add;
+    else
+        cnode_link(l, l->tail)->next = add;
+    l->tail = add;
+    l->len++;
+    return LLIST_OK;
+}
+
+// Inserts a new element into the given compact linked list. The element will 
+// be stored as a copy. 
+//
+// PARAMS: 
+// l - the compact linked list to have the element inserted
+// d - the element to insert
+// i - the index in the compact linked list to insert to
+//
+// RET: 
+// Zero on success, non-zero on error. 
+int cllist_ins(cllist_t *l, const void *d, size_t i) {
+    if (l == NULL || d == NULL)
+        return LLIST_NULL_ERR;
+    if (l->len == 0 || i >= l->len)
+        return cllist_add(l, d);        // let cllist_add handle out of range
+
+    uint32_t ins = cnode_new(l, d);
+    if (ins == CLLIST_NIL)
+        return LLIST_ALLOC_ERR;
+
+    uint32_t aft = cnode_get(l, i);     // lookup after growing the array
+    clink_t *link = cnode_link(l, ins);
+    clink_t *aft_link = cnode_link(l, aft);
+    link->prev = aft_link->prev;
+    link->next = aft;
+    if (aft_link->prev == CLLIST_NIL)   // insert to head
+        l->head = ins;
+    else                                // insert to mid
+        cnode_link(l, aft_link->prev)->next = ins;
+    aft_link->prev = ins;
+    l->len++;
+    return LLIST_OK;
+}
+
+// Deletes the element at the given index in the specified compact linked 
+// list. If the given index is out of range, then the last element will be 
+// deleted. 
+//
+// PARAMS: 
+// l   - the compact linked list to have the element deleted
+// i   - the index of the element
+// out - where to copy the deleted element, or NULL
+//
+// RET: 
+// Zero on success, non-zero on error. 
+int cllist_del(cllist_t *l, size_t i, void *out) {
+    uint32_t node = cnode_get(l, i);    // returns last if out of range
+    if (node == CLLIST_NIL)
+        return LLIST_NULL_ERR;
+
+    clink_t *link = cnode_link(l, node);
+    if (link->prev == CLLIST_NIL)
+        l->head = link->next;
+    else
+        cnode_link(l, link->prev)->next = link->next;
+    if (link->next == CLLIST_NIL)
+        l->tail = link->prev;
+    else
+        cnode_link(l, link->next)->prev = link->prev;
+    l->len--;
+
+    if (out != NULL)
+        memcpy(out, cnode_data(l, node), l->elem);
+    link->prev = CLLIST_NIL;            // push onto the free list
+    link->next = l->free;
+    l->free = node;
+    return LLIST_OK;
+}
+
+// Clears the given compact linked list, freeing the node array. 
+//
+// PARAMS: 
+// l - the compact linked list to free
+void cllist_clear(cllist_t *l) {
+    if (l != NULL) {
+        free(l->block);
+        l->block = NULL;
+        l->nodes = NULL;
+        l->head = CLLIST_NIL;
+        l->tail = CLLIST_NIL;
+        l->free = CLLIST_NIL;
+        l->cap = 0;
+        l->len = 0;
+    }
+}
+
+// Grows the node array of the given compact linked list, keeping it aligned 
+// within its allocation. The allocation has room to slide the array to the 
+// alignment, so the nodes are moved if realloc lands it elsewhere. 
+//
+// PARAMS: 
+// l   - the compact linked list owning the array
+// cap - the new capacity in nodes
+//
+// RET: 
+// Zero on success, non-zero on error. 
+static int cnode_grow(cllist_t *l, uint32_t cap) {
+    size_t old = (size_t)(l->nodes - l->block);
+    unsigned char *block = realloc(l->block, 
+        (size_t)cap * l->stride + l->align - 1);
+    if (block == NULL)
+        return LLIST_ALLOC_ERR;
+
+    size_t shift = (size_t)(-(uintptr_t)block & (l->align - 1));
+    if (l->block != NULL && shift != old)
+        memmove(block + shift, block + old, (size_t)l->cap * l->stride);
+    l->block = block;
+    l->nodes = block + shift;
+    return LLIST_OK;
+}
+
+// Returns the links of the given node. 
+//
+// PARAMS: 
+// l - the compact linked list owning the node
+// n - the index of the node
+//
+// RET: 
+// The links of the node. 
+static inline clink_t *cnode_link(const cllist_t *l, uint32_t n) {
+    return (clink_t *)(l->nodes + (size_t)n * l->stride);
+}
+
+// Returns the element stored in the given node. 
+//
+// PARAMS: 
+// l - the compact linked list owning the node
+// n - the index of the node
+//
+// RET: 
+// The element of the node. 
+static inline void *cnode_data(const cllist_t *l, uint32_t n) {
+    return l->nodes + (size_t)n * l->stride + CNODE_DATA(l);
+}
+
+// Takes a node from the free list, growing the node array if there is none, 
+// and copies the given element into it. 
+//
+// PARAMS: 
+// l - the compact linked list owning the node
+// d - the data in the node
+//
+// RET: 
+// The index of the new node, or CLLIST_NIL if any error occurred. 
+static uint32_t cnode_new(cllist_t *l, const void *d) {
+    if (l->free == CLLIST_NIL) {
+        if (l->cap == CLLIST_NIL - 1)
+            return CLLIST_NIL;      // out of indices
+
+        uint32_t cap = (l->cap == 0) ? 16 : 
+            (l->cap > (CLLIST_NIL - 1) / 2) ? (CLLIST_NIL - 1) : l->cap * 2;
+        if (cnode_grow(l, cap) != LLIST_OK)
+            return CLLIST_NIL;
+
+        for (uint32_t n = cap - 1; n > l->cap; n--)
+            cnode_link(l, n - 1)->next = n;
+        cnode_link(l, cap - 1)->next = CLLIST_NIL;
+        l->free = l->cap;
+        l->cap = cap;
+    }
+
+    uint32_t ret = l->free;
+    l->free = cnode_link(l, ret)->next;
+    memcpy(cnode_data(l, ret), d, l->elem);
+    return ret;
+}
+
+// Returns the index of the node at the specified index in the compact linked 
+// list. If the index is out of range, the last node will be returned. 
+//
+// PARAMS: 
+// l - the compact linked list to retrieve the node
+// i - the index of the node
+//
+// RET: 
+// The index of the node retrieved, or CLLIST_NIL if any error occurred. 
+static uint32_t cnode_get(const cllist_t *l, size_t i) {
+    if (l == NULL || l->len == 0)
+        return CLLIST_NIL;
+
+    uint32_t ret = CLLIST_NIL;
+    i = (i >= l->len) ? (l->len - 1) : i;
+    if (i >= l->len / 2) {      // node in upper half
+        ret = l->tail;
+        for (size_t j = 0; j < (l->len - i - 1); j++)
+            ret = cnode_link(l, ret)->prev;
+    } else {                    // node in lower half
+        ret = l->head;
+        for (size_t j = 0; j < i; j++)
+            ret = cnode_link(l, ret)->next;
+    }
+    return ret;
+}
+
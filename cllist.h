@@ -0,0 +1,120 @@
+///////////////////////////////////////////////////////////////////////////////
+// cllist.h
+// Compact linked list implementation in C99. Nodes live in one growable 
+// array and link to each other through 32-bit indices, so the whole list can 
+// be relocated and each node only carries 8 bytes of links. Elements are 
+// aligned as any type of their size could need, up to LLIST_ARENA_ALIGN, or 
+// to an alignment given at initialisation. 
+//
+// Author: agent
+// Date:   17/10/2026
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef CLLIST_H
+#define CLLIST_H
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include "llist.h"
+
+#define CLLIST_NIL UINT32_MAX               // null node index
+
+// The compact linked list link type, stored at the start of every node. 
+typedef struct compact_linked_list_link_t {
+    uint32_t prev;                          // index of previous
+    uint32_t next;                          // index of next
+} clink_t;
+
+// The compact linked list type. Every element has the same size. 
+typedef struct compact_linked_list_t {
+    unsigned char *block;                   // node array allocation
+    unsigned char *nodes;                   // node array, aligned in block
+    uint32_t head;                          // index of list head
+    uint32_t tail;                          // index of list tail
+    uint32_t free;                          // index of first free node
+    uint32_t cap;                           // node array capacity
+    size_t len;                             // list size
+    size_t elem;                            // size of every element
+    size_t stride;                          // size of every node
+    size_t align;                           // alignment of every element
+} cllist_t;
+
+// Initialises the specified compact linked list. 
+//
+// PARAMS: 
+// l    - the compact linked list to initialise
+// elem - the size of every element
+//
+// RET: 
+// Zero on success, non-zero on error. 
+int cllist_init(cllist_t *l, size_t elem);
+
+// Initialises the specified compact linked list, aligning every element to 
+// the given alignment. The element follows the links of its node, padded to 
+// the alignment, and the node array is aligned within its allocation. 
+//
+// PARAMS: 
+// l     - the compact linked list to initialise
+// elem  - the size of every element
+// align - the alignment of every element, a power of two
+//
+// RET: 
+// Zero on success, non-zero on error. 
+int cllist_init_align(cllist_t *l, size_t elem, size_t align);
+
+// Returns the element at the given index in the specified compact linked 
+// list. If the index is out of range, then the last element will be returned. 
+// The element may move when the list grows. 
+//
+// PARAMS: 
+// l - the compact linked list to retrieve the element
+// i - the index of the element
+//
+// RET: 
+// The element at the given index, or NULL if any error occurred. 
+void *cllist_get(const cllist_t *l, size_t i);
+
+// Add a new element into the given compact linked list. The element will be 
+// stored as a copy. 
+//
+// PARAMS: 
+// l - the compact linked list to have the element added
+// d - the element to add
+//
+// RET: 
+// Zero on success, non-zero on error. 
+int cllist_add(cllist_t *l, const void *d);
+
+// Inserts a new element into the given compact linked list. The element will 
+// be stored as a copy. 
+//
+// PARAMS: 
+// l - the compact linked list to have the element inserted
+// d - the element to insert
+// i - the index in the compact linked list to insert to
+//
+// RET: 
+// Zero on success, non-zero on error. 
+int cllist_ins(cllist_t *l, const void *d, size_t i);
+
+// Deletes the element at the given index in the specified compact linked 
+// list. If the given index is out of range, then the last element will be 
+// deleted. 
+//
+// PARAMS: 
+// l   - the compact linked list to have the element deleted
+// i   - the index of the element
+// out - where to copy the deleted element, or NULL
+//
+// RET: 
+// Zero on success, non-zero on error. 
+int cllist_del(cllist_t *l, size_t i, void *out);
+
+// Clears the given compact linked list, freeing the node array. 
+//
+// PARAMS: 
+// l - the compact linked list to free
+void cllist_clear(cllist_t *l);
+
+#endif
+
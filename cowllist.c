@@ -0,0 +1,448 @@
+///////////////////////////////////////////////////////////////////////////////
+// cowllist.c
+// Copy-on-write linked list implementation in C11. Elements are kept in 
+// reference counted segments, listed in a reference counted table. Taking a 
+// snapshot shares the table, and a change only copies the table and the one 
+// segment it touches while they are shared. Needs C11 for <stdatomic.h>. 
+//
+// The table caches the index of the first element of every segment, so a 
+// lookup is a binary search over the segments followed by one array access. 
+// A change costs O(len / COWLLIST_SEG) to update the cached indices after the 
+// changed segment. The first change after a snapshot also copies the whole 
+// table, taking a reference to every segment, which costs the same order of 
+// work again. Later changes to the same list find the table unshared. 
+//
+// Author: agent
+// Date:   17/10/2026
+///////////////////////////////////////////////////////////////////////////////
+
+#include "cowllist.h"
+
+static inline void ref_get(atomic_size_t *r);
+static inline bool ref_put(atomic_size_t *r);
+static inline bool ref_unique(atomic_size_t *r);
+static cowelem_t *elem_new(const void *d, size_t n);
+static void elem_release(cowelem_t *e);
+static cowseg_t *seg_new(void);
+static cowseg_t *seg_unique(cowtable_t *t, size_t s);
+static void seg_release(cowseg_t *s);
+static cowtable_t *table_unique(cowllist_t *l, size_t extra);
+static size_t table_find(const cowtable_t *t, size_t *i);
+static void table_recount(cowtable_t *t, size_t s);
+static void table_release(cowtable_t *t);
+
+// Initialises the specified copy-on-write linked list. 
+//
+// PARAMS: 
+// l - the copy-on-write linked list to initialise
+//
+// RET: 
+// Zero on success, non-zero on error. 
+int cowllist_init(cowllist_t *l) {
+    if (l == NULL)
+        return LLIST_NULL_ERR;
+
+    l->t = NULL;
+    return LLIST_OK;
+}
+
+// Returns the size of the specified copy-on-write linked list. 
+//
+// PARAMS: 
+// l - the copy-on-write linked list to measure
+//
+// RET: 
+// The number of elements in the list. 
+size_t cowllist_len(const cowllist_t *l) {
+    return (l == NULL || l->t == NULL) ? 0 : l->t->len;
+}
+
+// Returns the element at the given index in the specified copy-on-write 
+// linked list. If the index is out of range, then the last element will be 
+// returned. The element stays valid while any list or snapshot holds it. 
+//
+// PARAMS: 
+// l - the copy-on-write linked list to retrieve the element
+// i - the index of the element
+// n - where to store the size of the element, or NULL
+//
+// RET: 
+// The element at the given index, or NULL if any error occurred. 
+const void *cowllist_get(const cowllist_t *l, size_t i, size_t *n) {
+    if (cowllist_len(l) == 0)
+        return NULL;
+
+    i = (i >= l->t->len) ? (l->t->len - 1) : i;
+    cowelem_t *e = l->t->segs[table_find(l->t, &i)].seg->elems[i];
+    if (n != NULL)
+        *n = e->size;
+    return e->data;
+}
+
+// Add a new element into the given copy-on-write linked list. The element 
+// will be stored as a copy. 
+//
+// PARAMS: 
+// l - the copy-on-write linked list to have the element added
+// d - the element to add
+// n - the size of the element
+//
+// RET: 
+// Zero on success, non-zero on error. 
+int cowllist_add(cowllist_t *l, const void *d, size_t n) {
+    if (l == NULL || d == NULL || n == 0)
+        return LLIST_NULL_ERR;
+
+    cowelem_t *e = elem_new(d, n);
+    cowtable_t *t = (e != NULL) ? table_unique(l, 1) : NULL;
+    cowseg_t *s = NULL;
+    if (t != NULL && 
+        (t->cnt == 0 || t->segs[t->cnt - 1].seg->len == COWLLIST_SEG)) {
+        s = seg_new();                  // last segment full, start another
+        if (s != NULL) {
+            t->segs[t->cnt].seg = s;
+            t->segs[t->cnt++].start = t->len;
+        }
+    } else if (t != NULL) {
+        s = seg_unique(t, t->cnt - 1);
+    }
+    if (s == NULL) {
+        free(e);
+        return LLIST_ALLOC_ERR;
+    }
+
+    s->elems[s->len++] = e;
+    t->len++;
+    return LLIST_OK;
+}
+
+// Inserts a new element into the given copy-on-write linked list. The element 
+// will be stored as a copy. 
+//
+// PARAMS: 
+// l - the copy-on-write linked list to have the element inserted
+// d - the element to insert
+// n - the size of the element
+// i - the index in the copy-on-write linked list to insert to
+//
+// RET: 
+// Zero on success, non-zero on error. 
+int cowllist_ins(cowllist_t *l, const void *d, size_t n, size_t i) {
+    if (l == NULL || d == NULL || n == 0)
+        return LLIST_NULL_ERR;
+    if (i >= cowllist_len(l))
+        return cowllist_add(l, d, n);   // let cowllist_add handle out of range
+
+    cowelem_t *e = elem_new(d, n);
+    cowtable_t *t = (e != NULL) ? table_unique(l, 1) : NULL;
+    size_t si = (t != NULL) ? table_find(t, &i) : 0;
+    cowseg_t *s = (t != NULL) ? seg_unique(t, si) : NULL;
+    if (s != NULL && s->len == COWLLIST_SEG) {  // full, split in half
+        cowseg_t *half = seg_new();
+        if (half == NULL) {
+            s = NULL;
+        } else {
+            half->len = COWLLIST_SEG / 2;
+            memcpy(half->elems, s->elems + COWLLIST_SEG / 2, 
+                sizeof *half->elems * half->len);
+            s->len = COWLLIST_SEG / 2;
+            memmove(t->segs + si + 2, t->segs + si + 1, 
+                sizeof *t->segs * (t->cnt - si - 1));
+            t->segs[si + 1].seg = half;
+            t->cnt++;
+            if (i > COWLLIST_SEG / 2) {
+                s = half;
+                i -= COWLLIST_SEG / 2;
+            }
+        }
+    }
+    if (s == NULL) {
+        free(e);
+        return LLIST_ALLOC_ERR;
+    }
+
+    memmove(s->elems + i + 1, s->elems + i, sizeof *s->elems * (s->len - i));
+    s->elems[i] = e;
+    s->len++;
+    t->len++;
+    table_recount(t, si);
+    return LLIST_OK;
+}
+
+// Deletes the element at the given index in the specified copy-on-write 
+// linked list. If the given index is out of range, then the last element will 
+// be deleted. The element is freed once no snapshot holds it. 
+//
+// PARAMS: 
+// l - the copy-on-write linked list to have the element deleted
+// i - the index of the element
+//
+// RET: 
+// Zero on success, non-zero on error. 
+int cowllist_del(cowllist_t *l, size_t i) {
+    if (cowllist_len(l) == 0)
+        return LLIST_NULL_ERR;
+
+    i = (i >= l->t->len) ? (l->t->len - 1) : i;
+    cowtable_t *t = table_unique(l, 0);
+    size_t si = (t != NULL) ? table_find(t, &i) : 0;
+    cowseg_t *s = (t != NULL) ? seg_unique(t, si) : NULL;
+    if (s == NULL)
+        return LLIST_ALLOC_ERR;
+
+    elem_release(s->elems[i]);
+    memmove(s->elems + i, s->elems + i + 1, 
+        sizeof *s->elems * (s->len - i - 1));
+    s->len--;
+    t->len--;
+    if (s->len == 0) {                  // drop the empty segment
+        seg_release(s);
+        memmove(t->segs + si, t->segs + si + 1, 
+            sizeof *t->segs * (t->cnt - si - 1));
+        t->cnt--;
+    }
+    table_recount(t, si);
+    if (t->len == 0)
+        cowllist_clear(l);
+    return LLIST_OK;
+}
+
+// Initialises a copy-on-write linked list as a snapshot of another in O(1), 
+// by sharing its table. Later changes to either list do not affect the 
+// other. Must be called by the thread changing the source list. 
+//
+// PARAMS: 
+// dst - the copy-on-write linked list to initialise as the snapshot
+// src - the copy-on-write linked list to take the snapshot of
+//
+// RET: 
+// Zero on success, non-zero on error. 
+int cowllist_snapshot(cowllist_t *dst, const cowllist_t *src) {
+    if (dst == NULL || src == NULL)
+        return LLIST_NULL_ERR;
+
+    dst->t = src->t;
+    if (dst->t != NULL)
+        ref_get(&dst->t->refs);
+    return LLIST_OK;
+}
+
+// Clears the given copy-on-write linked list, dropping its reference to the 
+// shared table. Elements are freed once no snapshot holds them. 
+//
+// PARAMS: 
+// l - the copy-on-write linked list to free
+void cowllist_clear(cowllist_t *l) {
+    if (l != NULL && l->t != NULL) {
+        table_release(l->t);
+        l->t = NULL;
+    }
+}
+
+// Takes a reference to a shared object. 
+//
+// PARAMS: 
+// r - the reference count of the object
+static inline void ref_get(atomic_size_t *r) {
+    atomic_fetch_add_explicit(r, 1, memory_order_relaxed);
+}
+
+// Drops a reference to a shared object. Once this returns true, every change 
+// made through other references is visible, and the object can be freed. 
+//
+// PARAMS: 
+// r - the reference count of the object
+//
+// RET: 
+// True (1) if the last reference was dropped, 0 (false) otherwise. 
+static inline bool ref_put(atomic_size_t *r) {
+    return atomic_fetch_sub_explicit(r, 1, memory_order_acq_rel) == 1;
+}
+
+// Returns whether the caller holds the only reference to an object, in which 
+// case it can be changed in place. 
+//
+// PARAMS: 
+// r - the reference count of the object
+//
+// RET: 
+// True (1) if the object is not shared, 0 (false) otherwise. 
+static inline bool ref_unique(atomic_size_t *r) {
+    return atomic_load_explicit(r, memory_order_acquire) == 1;
+}
+
+// Returns a new element holding a copy of the given data. 
+//
+// PARAMS: 
+// d - the data to copy
+// n - the size of data
+//
+// RET: 
+// The new element, or NULL if any error occurred. 
+static cowelem_t *elem_new(const void *d, size_t n) {
+    cowelem_t *ret = malloc(sizeof *ret + n);
+    if (ret != NULL) {
+        atomic_init(&ret->refs, 1);
+        ret->size = n;
+        memcpy(ret->data, d, n);
+    }
+    return ret;
+}
+
+// Drops a reference to the given element, freeing it if it was the last. 
+//
+// PARAMS: 
+// e - the element to release
+static void elem_release(cowelem_t *e) {
+    if (ref_put(&e->refs))
+        free(e);
+}
+
+// Returns a new empty segment. 
+//
+// RET: 
+// The new segment, or NULL if any error occurred. 
+static cowseg_t *seg_new(void) {
+    cowseg_t *ret = malloc(sizeof *ret);
+    if (ret != NULL) {
+        atomic_init(&ret->refs, 1);
+        ret->len = 0;
+    }
+    return ret;
+}
+
+// Returns the segment at the given position of an unshared table, copying it 
+// first if it is shared. The copy shares the elements. 
+//
+// PARAMS: 
+// t - the unshared table holding the segment
+// s - the position of the segment
+//
+// RET: 
+// The unshared segment, or NULL if any error occurred. 
+static cowseg_t *seg_unique(cowtable_t *t, size_t s) {
+    cowseg_t *old = t->segs[s].seg;
+    if (ref_unique(&old->refs))
+        return old;
+
+    cowseg_t *ret = seg_new();
+    if (ret != NULL) {
+        ret->len = old->len;
+        for (size_t i = 0; i < old->len; i++) {
+            ret->elems[i] = old->elems[i];
+            ref_get(&ret->elems[i]->refs);
+        }
+        seg_release(old);
+        t->segs[s].seg = ret;
+    }
+    return ret;
+}
+
+// Drops a reference to the given segment, releasing its elements and freeing 
+// it if it was the last. 
+//
+// PARAMS: 
+// s - the segment to release
+static void seg_release(cowseg_t *s) {
+    if (ref_put(&s->refs)) {
+        for (size_t i = 0; i < s->len; i++)
+            elem_release(s->elems[i]);
+        free(s);
+    }
+}
+
+// Returns the table of the given list, made unshared and with room for extra 
+// segments. A shared table is copied, sharing its segments. 
+//
+// PARAMS: 
+// l     - the copy-on-write linked list owning the table
+// extra - the number of segments that may be added
+//
+// RET: 
+// The unshared table, or NULL if any error occurred. 
+static cowtable_t *table_unique(cowllist_t *l, size_t extra) {
+    cowtable_t *old = l->t;
+    size_t need = ((old != NULL) ? old->cnt : 0) + extra;
+    if (old != NULL && ref_unique(&old->refs) && old->cap >= need)
+        return old;
+
+    size_t cap = (old != NULL && old->cap > 4) ? old->cap : 4;
+    while (cap < need)
+        cap *= 2;
+    cowtable_t *ret = NULL;
+    if (old != NULL && ref_unique(&old->refs)) {    // grow in place
+        ret = realloc(old, sizeof *ret + sizeof *ret->segs * cap);
+        if (ret != NULL) {
+            ret->cap = cap;
+            l->t = ret;
+        }
+        return ret;
+    }
+
+    ret = malloc(sizeof *ret + sizeof *ret->segs * cap);
+    if (ret != NULL) {
+        atomic_init(&ret->refs, 1);
+        ret->len = (old != NULL) ? old->len : 0;
+        ret->cnt = (old != NULL) ? old->cnt : 0;
+        ret->cap = cap;
+        for (size_t i = 0; i < ret->cnt; i++) {
+            ret->segs[i] = old->segs[i];
+            ref_get(&ret->segs[i].seg->refs);
+        }
+        if (old != NULL)
+            table_release(old);
+        l->t = ret;
+    }
+    return ret;
+}
+
+// Returns the position of the segment holding the given index of a table, 
+// and turns the index into an offset in that segment. The cached start 
+// indices are binary searched. 
+//
+// PARAMS: 
+// t - the table to search
+// i - the index in range to find, replaced by the offset in the segment
+//
+// RET: 
+// The position of the segment. 
+static size_t table_find(const cowtable_t *t, size_t *i) {
+    size_t lo = 0;                      // last segment starting at or before i
+    size_t hi = t->cnt;
+    while (hi - lo > 1) {
+        size_t mid = lo + (hi - lo) / 2;
+        if (t->segs[mid].start <= *i)
+            lo = mid;
+        else
+            hi = mid;
+    }
+    *i -= t->segs[lo].start;
+    return lo;
+}
+
+// Recomputes the cached start indices of an unshared table from the given 
+// segment on, after the segments before it kept their sizes. 
+//
+// PARAMS: 
+// t - the unshared table to update
+// s - the position of the first segment whose start may have changed
+static void table_recount(cowtable_t *t, size_t s) {
+    for (size_t j = s; j < t->cnt; j++) {
+        t->segs[j].start = (j == 0) ? 0 : 
+            t->segs[j - 1].start + t->segs[j - 1].seg->len;
+    }
+}
+
+// Drops a reference to the given table, releasing its segments and freeing 
+// it if it was the last. 
+//
+// PARAMS: 
+// t - the table to release
+static void table_release(cowtable_t *t) {
+    if (ref_put(&t->refs)) {
+        for (size_t i = 0; i < t->cnt; i++)
+            seg_release(t->segs[i].seg);
+        free(t);
+    }
+}
+
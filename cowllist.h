@@ -0,0 +1,153 @@
+///////////////////////////////////////////////////////////////////////////////
+// cowllist.h
+// Copy-on-write linked list implementation in C11. Elements are kept in 
+// reference counted segments, listed in a reference counted table. Taking a 
+// snapshot shares the table, and a change only copies the table and the one 
+// segment it touches while they are shared. Needs C11 for <stdatomic.h>. 
+//
+// The table caches the index of the first element of every segment, so a 
+// lookup is a binary search over the segments followed by one array access. 
+// A change costs O(len / COWLLIST_SEG) to update the cached indices after the 
+// changed segment. The first change after a snapshot also copies the whole 
+// table, taking a reference to every segment, which costs the same order of 
+// work again. Later changes to the same list find the table unshared. 
+//
+// Author: agent
+// Date:   17/10/2026
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef COWLLIST_H
+#define COWLLIST_H
+#include <stdlib.h>
+#include <stdatomic.h>
+#include <string.h>
+#include "llist.h"
+
+#define COWLLIST_SEG 64                     // most elements per segment
+
+// The copy-on-write linked list element type. Elements never change once 
+// created, so segments share them. 
+typedef struct cow_linked_list_elem_t {
+    atomic_size_t refs;                     // segments holding the element
+    size_t size;                            // size of data
+    unsigned char data[];                   // element data
+} cowelem_t;
+
+// The copy-on-write linked list segment type. 
+typedef struct cow_linked_list_seg_t {
+    atomic_size_t refs;                     // tables holding the segment
+    size_t len;                             // elements in the segment
+    cowelem_t *elems[COWLLIST_SEG];         // elements in order
+} cowseg_t;
+
+// The copy-on-write linked list table entry type. 
+typedef struct cow_linked_list_entry_t {
+    cowseg_t *seg;                          // the segment
+    size_t start;                           // list index of its first element
+} cowentry_t;
+
+// The copy-on-write linked list table type. 
+typedef struct cow_linked_list_table_t {
+    atomic_size_t refs;                     // lists holding the table
+    size_t len;                             // list size
+    size_t cnt;                             // segments in use
+    size_t cap;                             // segment capacity
+    cowentry_t segs[];                      // segments in order
+} cowtable_t;
+
+// The copy-on-write linked list type. Each list or snapshot owns a reference 
+// to a table. A list must only be changed by one thread at a time, but its 
+// snapshots can be read by other threads without locking. 
+typedef struct cow_linked_list_t {
+    cowtable_t *t;                          // shared table, NULL if empty
+} cowllist_t;
+
+// Initialises the specified copy-on-write linked list. 
+//
+// PARAMS: 
+// l - the copy-on-write linked list to initialise
+//
+// RET: 
+// Zero on success, non-zero on error. 
+int cowllist_init(cowllist_t *l);
+
+// Returns the size of the specified copy-on-write linked list. 
+//
+// PARAMS: 
+// l - the copy-on-write linked list to measure
+//
+// RET: 
+// The number of elements in the list. 
+size_t cowllist_len(const cowllist_t *l);
+
+// Returns the element at the given index in the specified copy-on-write 
+// linked list. If the index is out of range, then the last element will be 
+// returned. The element stays valid while any list or snapshot holds it. 
+//
+// PARAMS: 
+// l - the copy-on-write linked list to retrieve the element
+// i - the index of the element
+// n - where to store the size of the element, or NULL
+//
+// RET: 
+// The element at the given index, or NULL if any error occurred. 
+const void *cowllist_get(const cowllist_t *l, size_t i, size_t *n);
+
+// Add a new element into the given copy-on-write linked list. The element 
+// will be stored as a copy. 
+//
+// PARAMS: 
+// l - the copy-on-write linked list to have the element added
+// d - the element to add
+// n - the size of the element
+//
+// RET: 
+// Zero on success, non-zero on error. 
+int cowllist_add(cowllist_t *l, const void *d, size_t n);
+
+// Inserts a new element into the given copy-on-write linked list. The element 
+// will be stored as a copy. 
+//
+// PARAMS: 
+// l - the copy-on-write linked list to have the element inserted
+// d - the element to insert
+// n - the size of the element
+// i - the index in the copy-on-write linked list to insert to
+//
+// RET: 
+// Zero on success, non-zero on error. 
+int cowllist_ins(cowllist_t *l, const void *d, size_t n, size_t i);
+
+// Deletes the element at the given index in the specified copy-on-write 
+// linked list. If the given index is out of range, then the last element will 
+// be deleted. The element is freed once no snapshot holds it. 
+//
+// PARAMS: 
+// l - the copy-on-write linked list to have the element deleted
+// i - the index of the element
+//
+// RET: 
+// Zero on success, non-zero on error. 
+int cowllist_del(cowllist_t *l, size_t i);
+
+// Initialises a copy-on-write linked list as a snapshot of another in O(1), 
+// by sharing its table. Later changes to either list do not affect the 
+// other. Must be called by the thread changing the source list. 
+//
+// PARAMS: 
+// dst - the copy-on-write linked list to initialise as the snapshot
+// src - the copy-on-write linked list to take the snapshot of
+//
+// RET: 
+// Zero on success, non-zero on error. 
+int cowllist_snapshot(cowllist_t *dst, const cowllist_t *src);
+
+// Clears the given copy-on-write linked list, dropping its reference to the 
+// shared table. Elements are freed once no snapshot holds them. 
+//
+// PARAMS: 
+// l - the copy-on-write linked list to free
+void cowllist_clear(cowllist_t *l);
+
+#endif
+
@@ -0,0 +1,247 @@
+///////////////////////////////////////////////////////////////////////////////
+// dqlist.c
+// Deque list implementation in C99. Fixed size elements are kept in a ring of 
+// chunks, indexed by a power of two map, so pushing and popping at either end 
+// and indexing take O(1) time. Chunks are kept once allocated, so a list used 
+// as a FIFO stops allocating once it reaches its working size. 
+//
+// Author: agent
+// Date:   17/10/2026
+///////////////////////////////////////////////////////////////////////////////
+
+#include "dqlist.h"
+
+static inline size_t dq_ring(const dqlist_t *l);
+static inline unsigned char *dq_slot(const dqlist_t *l, size_t i);
+static int dq_chunk(dqlist_t *l, size_t p);
+static int dq_grow(dqlist_t *l);
+
+// Initialises the specified deque list. 
+//
+// PARAMS: 
+// l    - the deque list to initialise
+// elem - the size of every element
+// max  - the most elements the list may hold, or 0 for no bound
+//
+// RET: 
+// Zero on success, non-zero on error. 
+int dqlist_init(dqlist_t *l, size_t elem, size_t max) {
+    if (l == NULL || elem == 0)
+        return LLIST_NULL_ERR;
+
+    l->map = NULL;
+    l->slots = 0;
+    l->shift = 0;
+    while (((size_t)2 << l->shift) * elem <= DQLIST_CHUNK)
+        l->shift++;                     // largest power of two that fits
+    l->head = 0;
+    l->len = 0;
+    l->elem = elem;
+    l->max = max;
+    return LLIST_OK;
+}
+
+// Returns the element at the given index in the specified deque list. If the 
+// index is out of range, then the last element will be returned. The element 
+// may be overwritten once it is deleted. 
+//
+// PARAMS: 
+// l - the deque list to retrieve the element
+// i - the index of the element
+//
+// RET: 
+// The element at the given index, or NULL if any error occurred. 
+void *dqlist_get(const dqlist_t *l, size_t i) {
+    if (l == NULL || l->len == 0)
+        return NULL;
+    return dq_slot(l, (i >= l->len) ? (l->len - 1) : i);
+}
+
+// Add a new element to the tail of the given deque list. The element will be 
+// stored as a copy. 
+//
+// PARAMS: 
+// l - the deque list to have the element added
+// d - the element to add
+//
+// RET: 
+// Zero on success, LLIST_FULL_ERR if the list is at its bound, other 
+// non-zero on error. 
+int dqlist_add(dqlist_t *l, const void *d) {
+    if (l == NULL || d == NULL)
+        return LLIST_NULL_ERR;
+    if (l->max != 0 && l->len >= l->max)
+        return LLIST_FULL_ERR;
+    if (l->len == dq_ring(l) && dq_grow(l) != LLIST_OK)
+        return LLIST_ALLOC_ERR;
+    if (dq_chunk(l, l->head + l->len) != LLIST_OK)
+        return LLIST_ALLOC_ERR;
+
+    memcpy(dq_slot(l, l->len), d, l->elem);
+    l->len++;
+    return LLIST_OK;
+}
+
+// Inserts a new element into the given deque list. The element will be stored 
+// as a copy. Elements between the index and the nearer end are shifted, so 
+// inserting at either end takes O(1) time. 
+//
+// PARAMS: 
+// l - the deque list to have the element inserted
+// d - the element to insert
+// i - the index in the deque list to insert to
+//
+// RET: 
+// Zero on success, LLIST_FULL_ERR if the list is at its bound, other 
+// non-zero on error. 
+int dqlist_ins(dqlist_t *l, const void *d, size_t i) {
+    if (l == NULL || d == NULL)
+        return LLIST_NULL_ERR;
+    if (i >= l->len)
+        return dqlist_add(l, d);        // let dqlist_add handle out of range
+    if (l->max != 0 && l->len >= l->max)
+        return LLIST_FULL_ERR;
+    if (l->len == dq_ring(l) && dq_grow(l) != LLIST_OK)
+        return LLIST_ALLOC_ERR;
+
+    if (i < l->len - i) {               // shift the front down
+        if (dq_chunk(l, l->head + dq_ring(l) - 1) != LLIST_OK)
+            return LLIST_ALLOC_ERR;
+        l->head = (l->head + dq_ring(l) - 1) & (dq_ring(l) - 1);
+        for (size_t k = 0; k < i; k++)
+            memcpy(dq_slot(l, k), dq_slot(l, k + 1), l->elem);
+    } else {                            // shift the back up
+        if (dq_chunk(l, l->head + l->len) != LLIST_OK)
+            return LLIST_ALLOC_ERR;
+        for (size_t k = l->len; k > i; k--)
+            memcpy(dq_slot(l, k), dq_slot(l, k - 1), l->elem);
+    }
+    memcpy(dq_slot(l, i), d, l->elem);
+    l->len++;
+    return LLIST_OK;
+}
+
+// Deletes the element at the given index in the specified deque list. If the 
+// given index is out of range, then the last element will be deleted. Elements 
+// between the index and the nearer end are shifted, so deleting at either end 
+// takes O(1) time. 
+//
+// PARAMS: 
+// l   - the deque list to have the element deleted
+// i   - the index of the element
+// out - where to copy the deleted element, or NULL
+//
+// RET: 
+// Zero on success, non-zero on error. 
+int dqlist_del(dqlist_t *l, size_t i, void *out) {
+    if (l == NULL || l->len == 0)
+        return LLIST_NULL_ERR;
+
+    i = (i >= l->len) ? (l->len - 1) : i;
+    if (out != NULL)
+        memcpy(out, dq_slot(l, i), l->elem);
+    if (i < l->len - 1 - i) {           // shift the front up
+        for (size_t k = i; k > 0; k--)
+            memcpy(dq_slot(l, k), dq_slot(l, k - 1), l->elem);
+        l->head = (l->head + 1) & (dq_ring(l) - 1);
+    } else {                            // shift the back down
+        for (size_t k = i; k + 1 < l->len; k++)
+            memcpy(dq_slot(l, k), dq_slot(l, k + 1), l->elem);
+    }
+    l->len--;
+    return LLIST_OK;
+}
+
+// Clears the given deque list, freeing every chunk and the map. 
+//
+// PARAMS: 
+// l - the deque list to free
+void dqlist_clear(dqlist_t *l) {
+    if (l != NULL) {
+        for (size_t i = 0; i < l->slots; i++)
+            free(l->map[i]);
+        free(l->map);
+        l->map = NULL;
+        l->slots = 0;
+        l->head = 0;
+        l->len = 0;
+    }
+}
+
+// Returns the number of elements the ring of the given deque list can hold. 
+//
+// PARAMS: 
+// l - the deque list to measure
+//
+// RET: 
+// The ring capacity, a power of two or 0. 
+static inline size_t dq_ring(const dqlist_t *l) {
+    return l->slots << l->shift;
+}
+
+// Returns the element at the given index of the given deque list. The index 
+// may be at most the ring capacity. 
+//
+// PARAMS: 
+// l - the deque list to retrieve the element
+// i - the index of the element
+//
+// RET: 
+// The element at the given index. 
+static inline unsigned char *dq_slot(const dqlist_t *l, size_t i) {
+    size_t p = (l->head + i) & (dq_ring(l) - 1);
+    size_t mask = ((size_t)1 << l->shift) - 1;
+    return l->map[p >> l->shift] + (p & mask) * l->elem;
+}
+
+// Allocates the chunk holding the given ring position, unless it is already 
+// allocated. 
+//
+// PARAMS: 
+// l - the deque list owning the ring
+// p - the ring position, taken modulo the ring capacity
+//
+// RET: 
+// Zero on success, non-zero on error. 
+static int dq_chunk(dqlist_t *l, size_t p) {
+    unsigned char **c = &l->map[(p & (dq_ring(l) - 1)) >> l->shift];
+    if (*c == NULL)
+        *c = malloc(l->elem << l->shift);
+    return (*c != NULL) ? LLIST_OK : LLIST_ALLOC_ERR;
+}
+
+// Doubles the map of the given full deque list. The chunks are moved to the 
+// new map in list order starting from the head chunk. When the head is inside 
+// its chunk, the tail also wraps into the start of that chunk, so those 
+// elements are copied into a new chunk after the old ones. 
+//
+// PARAMS: 
+// l - the full deque list to grow
+//
+// RET: 
+// Zero on success, non-zero on error. 
+static int dq_grow(dqlist_t *l) {
+    size_t slots = (l->slots == 0) ? DQLIST_SLOTS : l->slots * 2;
+    unsigned char **map = calloc(slots, sizeof *map);
+    if (map == NULL)
+        return LLIST_ALLOC_ERR;
+
+    size_t first = l->head >> l->shift;
+    size_t off = l->head & (((size_t)1 << l->shift) - 1);
+    if (off != 0) {
+        map[l->slots] = malloc(l->elem << l->shift);
+        if (map[l->slots] == NULL) {
+            free(map);
+            return LLIST_ALLOC_ERR;
+        }
+        memcpy(map[l->slots], l->map[first], off * l->elem);
+    }
+    for (size_t i = 0; i < l->slots; i++)
+        map[i] = l->map[(first + i) & (l->slots - 1)];
+    free(l->map);
+    l->map = map;
+    l->slots = slots;
+    l->head = off;
+    return LLIST_OK;
+}
+
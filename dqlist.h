@@ -0,0 +1,103 @@
+///////////////////////////////////////////////////////////////////////////////
+// dqlist.h
+// Deque list implementation in C99. Fixed size elements are kept in a ring of 
+// chunks, indexed by a power of two map, so pushing and popping at either end 
+// and indexing take O(1) time. Chunks are kept once allocated, so a list used 
+// as a FIFO stops allocating once it reaches its working size. 
+//
+// Author: agent
+// Date:   17/10/2026
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef DQLIST_H
+#define DQLIST_H
+#include <stdlib.h>
+#include <string.h>
+#include "llist.h"
+
+#define DQLIST_CHUNK 4096                   // preferred chunk size in bytes
+#define DQLIST_SLOTS 4                      // initial map size
+
+// The deque list type. Every element has the same size. Ring position p is 
+// element p & mask of chunk p >> shift, where mask covers one chunk. 
+typedef struct deque_list_t {
+    unsigned char **map;                    // chunk of every slot, or NULL
+    size_t slots;                           // map size, a power of two
+    size_t shift;                           // log2 of elements per chunk
+    size_t head;                            // ring position of list head
+    size_t len;                             // list size
+    size_t elem;                            // size of every element
+    size_t max;                             // most elements, 0 if unbounded
+} dqlist_t;
+
+// Initialises the specified deque list. 
+//
+// PARAMS: 
+// l    - the deque list to initialise
+// elem - the size of every element
+// max  - the most elements the list may hold, or 0 for no bound
+//
+// RET: 
+// Zero on success, non-zero on error. 
+int dqlist_init(dqlist_t *l, size_t elem, size_t max);
+
+// Returns the element at the given index in the specified deque list. If the 
+// index is out of range, then the last element will be returned. The element 
+// may be overwritten once it is deleted. 
+//
+// PARAMS: 
+// l - the deque list to retrieve the element
+// i - the index of the element
+//
+// RET: 
+// The element at the given index, or NULL if any error occurred. 
+void *dqlist_get(const dqlist_t *l, size_t i);
+
+// Add a new element to the tail of the given deque list. The element will be 
+// stored as a copy. 
+//
+// PARAMS: 
+// l - the deque list to have the element added
+// d - the element to add
+//
+// RET: 
+// Zero on success, LLIST_FULL_ERR if the list is at its bound, other 
+// non-zero on error. 
+int dqlist_add(dqlist_t *l, const void *d);
+
+// Inserts a new element into the given deque list. The element will be stored 
+// as a copy. Elements between the index and the nearer end are shifted, so 
+// inserting at either end takes O(1) time. 
+//
+// PARAMS: 
+// l - the deque list to have the element inserted
+// d - the element to insert
+// i - the index in the deque list to insert to
+//
+// RET: 
+// Zero on success, LLIST_FULL_ERR if the list is at its bound, other 
+// non-zero on error. 
+int dqlist_ins(dqlist_t *l, const void *d, size_t i);
+
+// Deletes the element at the given index in the specified deque list. If the 
+// given index is out of range, then the last element will be deleted. Elements 
+// between the index and the nearer end are shifted, so deleting at either end 
+// takes O(1) time. 
+//
+// PARAMS: 
+// l   - the deque list to have the element deleted
+// i   - the index of the element
+// out - where to copy the deleted element, or NULL
+//
+// RET: 
+// Zero on success, non-zero on error. 
+int dqlist_del(dqlist_t *l, size_t i, void *out);
+
+// Clears the given deque list, freeing every chunk and the map. 
+//
+// PARAMS: 
+// l - the deque list to free
+void dqlist_clear(dqlist_t *l);
+
+#endif
+
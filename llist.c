@@ -6,15 +6,111 @@
 // Date:   12/04/2019
 ///////////////////////////////////////////////////////////////////////////////
 
+#ifdef LLIST_TRACE
+#define _POSIX_C_SOURCE 200809L
+#endif
 #include "llist.h"
+#include <stddef.h>
+#include <stdint.h>
+#ifdef LLIST_TRACE
+#include <time.h>
+#endif
+
+// Bytes of a node before u, which is all a tiny node takes. 
+#define LNODE_BASE offsetof(lnode_t, u)
+
+// Offset of elements stored after their node in an arena, keeping them at the 
+// arena alignment. 
+#define LNODE_HDR ((LNODE_BASE + sizeof(void *) + LLIST_ARENA_ALIGN - 1) & \
+    ~(size_t)(LLIST_ARENA_ALIGN - 1))
+
+// Fails to compile if a tiny node outgrows 24 bytes or a full one 40, which 
+// would undo the saving of storing small elements in their node. 
+typedef char lnode_size_check[
+    (LNODE_BASE <= 24 && sizeof(lnode_t) <= 40) ? 1 : -1];
+
+// Bytes of the first pool slab, and the most later slabs grow to. 
+#define LPOOL_SLAB_MIN 1024
+#define LPOOL_SLAB_MAX 65536
+
+// Size classes of pooled nodes, one per 8 bytes of node stride. 
+#define LPOOL_CLASSES ((LNODE_BASE + LLIST_INLINE_MAX + \
+    LLIST_ARENA_ALIGN - 1) / 8 - LNODE_BASE / 8 + 1)
+
+// The node pool type. Heap list nodes are carved from slabs, and freed nodes 
+// wait on the free list of their size class for the next add, so a small 
+// element costs its node and no malloc header. Lists split from one another 
+// share a pool, which is freed with the last of them. 
+typedef struct linked_list_pool_t {
+    lchunk_t *slabs;                        // slabs, newest first
+    lnode_t *free[LPOOL_CLASSES];           // freed nodes of each class
+    size_t refs;                            // lists using the pool
+} lpool_t;
+
+// Slots in a new handle slot table. 
+#define LSLOT_MIN 16
+
+// The handle slot type. A slot names one node, and its generation changes 
+// every time it is given to another node, so old handles to it go stale. 
+typedef struct linked_list_slot_t {
+    lnode_t *node;                          // the node, NULL if free
+    uint32_t gen;                           // generation of the node
+    uint32_t next;                          // next free slot, 0 if none
+} lslot_t;
+
+// Updates a counter of the given list. Statistics are kept in lists reached 
+// through const pointers too, so the const is dropped. 
+#ifdef LLIST_STATS
+#define LLIST_STAT(l, expr) ((void)(((llist_t *)(l))->stats.expr))
+#else
+#define LLIST_STAT(l, expr) ((void)(l))
+#endif
+
+static llist_trace_fn trace_fn = NULL;     // trace hook
+static void *trace_ctx = NULL;              // trace hook context
+static size_t budget = 0;                   // global budget, 0 if none
+static size_t budget_used = 0;              // bytes charged to the budget
 
 static inline _Bool llist_empty(const llist_t *l);
-static lnode_t *lnode_new(const void *d, size_t n);
-static lnode_t *lnode_get(const llist_t *l, size_t i);
-static void lnode_free_whole(lnode_t *n);
-static void *lnode_free(lnode_t *n);
+static int llist_add_node(llist_t *l, const void *d, size_t n, 
+        lnode_t **out);
+static int llist_ins_node(llist_t *l, const void *d, size_t n, size_t i, 
+        lnode_t **out);
+static void llist_unlink(llist_t *l, lnode_t *n);
+static void llist_link_tail(llist_t *l, lnode_t *n);
+static void index_drop(llist_t *l);
+static lnode_t *handle_node(const llist_t *l, llist_handle_t h);
+static int slot_reserve(llist_t *l);
+static void slot_bind(llist_t *l, lnode_t *n, llist_handle_t *out);
+static void slot_release(llist_t *l, lnode_t *n);
+static void slot_free(llist_t *l);
+static size_t slot_cost(const llist_t *l);
+static void *chunk_bump(lchunk_t *c, size_t n, size_t align, size_t phase);
+static void *arena_alloc(llist_t *l, size_t n, size_t align, size_t phase);
+static void arena_free(llist_t *l);
+static lnode_t *pool_take(llist_t *l, size_t n, bool slotted);
+static void pool_put(llist_t *l, lnode_t *n);
+static void pool_drop(llist_t *l);
+static size_t alloc_est(size_t n);
+static size_t lnode_len(size_t n, bool slotted);
+static size_t lnode_align(const llist_t *l, size_t n, size_t *phase);
+static size_t lnode_stride(const llist_t *l, size_t n, bool slotted);
+static uint32_t *lnode_slot(lnode_t *n);
+static size_t lnode_span(const llist_t *l, size_t n, bool slotted);
+static size_t lnode_cost(const llist_t *l, size_t n, bool slotted);
+static bool budget_allows(const llist_t *l, size_t n, bool slotted);
+static bool budget_fits(const llist_t *l, size_t cost);
+static void mem_charge(llist_t *l, size_t n);
+static void mem_release(llist_t *l, size_t n);
+static lnode_t *lnode_new(llist_t *l, const void *d, size_t n, bool slotted);
+static lnode_t *lnode_get(const llist_t *l, size_t i, size_t *hops);
+static int lnode_copy_all(llist_t *dst, const llist_t *src);
+static void lnode_free_whole(llist_t *l, lnode_t *n);
+static void *lnode_free(llist_t *l, lnode_t *n);
 
-// Initialises the specified linked list. 
+// Initialises the specified linked list. Nodes are carved from slabs of a 
+// node pool owned by the list, and the nodes of deleted elements are reused 
+// by later adds until the list is cleared. 
 //
 // PARAMS: 
 // l - the linked list to initialise
@@ -28,9 +124,43 @@ int llist_init(llist_t *l) {
     l->head = NULL;
     l->tail = NULL;
     l->len = 0;
+    l->arena = NULL;
+    l->pool = NULL;
+    l->chunk = 0;
+    l->bytes = 0;
+    l->heap = 0;
+    l->metered = (budget != 0);
+    l->index = NULL;
+    l->slots = NULL;
+    l->cap = 0;
+    l->top = 0;
+    l->free = 0;
+    l->gen = 0;
+    llist_stats_reset(l);
+    // the hook reads the list, so entry is only reported once it is set 
+    LLIST_TRACE_EVENT(LLIST_OP_INIT, LLIST_TRACE_ENTER, l, 0, 0, 0);
+    LLIST_TRACE_EVENT(LLIST_OP_INIT, LLIST_TRACE_EXIT, l, 0, 0, 0);
     return LLIST_OK;
 }
 
+// Initialises the specified linked list in arena mode. Nodes and elements are 
+// bump allocated from chunks attached to the list. Elements can not be freed 
+// individually: llist_del only unlinks them, and llist_clear releases every 
+// chunk at once. 
+//
+// PARAMS: 
+// l     - the linked list to initialise
+// chunk - the size of each arena chunk, or 0 for LLIST_ARENA_CHUNK
+//
+// RET: 
+// Zero on success, non-zero on error. 
+int llist_init_arena(llist_t *l, size_t chunk) {
+    int ret = llist_init(l);
+    if (ret == LLIST_OK)
+        l->chunk = (chunk == 0) ? LLIST_ARENA_CHUNK : chunk;
+    return ret;
+}
+
 // Returns the element at the given index in the specified linked list. If the 
 // index is out of range, then the last element will be returned. 
 //
@@ -41,10 +171,15 @@ int llist_init(llist_t *l) {
 // RET: 
 // The element at the given index, or NULL if any error occurred. 
 void *llist_get(const llist_t *l, size_t i) {
-    lnode_t *node = lnode_get(l, i);
+    if (l != NULL)
+        LLIST_STAT(l, gets++);
+    LLIST_TRACE_EVENT(LLIST_OP_GET, LLIST_TRACE_ENTER, l, i, 0, 0);
+    size_t hops = 0;
+    lnode_t *node = lnode_get(l, i, &hops);
     void *ret = NULL;
     if (node != NULL)
-        ret = node->data;
+        ret = lnode_data(node);
+    LLIST_TRACE_EVENT(LLIST_OP_GET, LLIST_TRACE_EXIT, l, i, hops, 0);
     return ret;
 }
 
@@ -54,28 +189,35 @@ void *llist_get(const llist_t *l, size_t i) {
 // PARAMS: 
 // l - the linked list to have the element added
 // d - the element to add
-// n - the size of the element
+// n - the size of the element, at most LLIST_ELEM_MAX
 //
 // RET: 
 // Zero on success, non-zero on error. 
 int llist_add(llist_t *l, const void *d, size_t n) {
-    if (l == NULL || d == NULL || n == 0)
+    if (d == NULL)
         return LLIST_NULL_ERR;
+    return llist_add_node(l, d, n, NULL);
+}
 
-    int ret = LLIST_ALLOC_ERR;
-    lnode_t *add = lnode_new(d, n);
-    if (add != NULL) {
-        ret = LLIST_OK;
-        if (l->len == 0) {      // list is empty
-            l->head = add;
-            l->tail = add;
-        } else {
-            l->tail->next = add;
-            add->prev = l->tail;
-            l->tail = l->tail->next;
-        }
-        l->len++;
-    }
+// Adds a new element of the given size into the given linked list without 
+// copying anything into it, and returns where the element is stored, for the 
+// caller to fill before the list is used again. 
+//
+// PARAMS: 
+// l   - the linked list to have the element added
+// n   - the size of the element, at most LLIST_ELEM_MAX
+// out - where to store the element
+//
+// RET: 
+// Zero on success, non-zero on error. 
+int llist_add_uninit(llist_t *l, size_t n, void **out) {
+    if (out == NULL)
+        return LLIST_NULL_ERR;
+
+    *out = NULL;
+    int ret = llist_add_node(l, NULL, n, NULL);
+    if (ret == LLIST_OK)
+        *out = lnode_data(l->tail);
     return ret;
 }
 
@@ -85,116 +227,1182 @@ int llist_add(llist_t *l, const void *d, size_t n) {
 // PARAMS: 
 // l - the linked list to have the element inserted
 // d - the element to insert
-// n - the size of the element
+// n - the size of the element, at most LLIST_ELEM_MAX
 // i - the index in the linked list to insert to
 //
 // RET: 
 // Zero on success, non-zero on error. 
 int llist_ins(llist_t *l, const void *d, size_t n, size_t i) {
-    if (l == NULL || d == NULL || n == 0)
+    return llist_ins_node(l, d, n, i, NULL);
+}
+
+// Deletes the element at the given index in the specified linked list. If the 
+// given index is out of range, then the last element will be deleted. The 
+// returned element should be freed by the caller, unless the list is in arena 
+// mode, where it stays valid until the list is cleared. Elements stored in 
+// their node are copied out first, as the node goes back to the pool. 
+//
+// PARAMS: 
+// l - the linked list to have the element deleted
+// i - the index of the element
+//
+// RET: 
+// The element that just got removed, or NULL if any error occurred, in which 
+// case the element stays in the list. 
+void *llist_del(llist_t *l, size_t i) {
+    if (l != NULL)
+        LLIST_STAT(l, dels++);
+    LLIST_TRACE_EVENT(LLIST_OP_DEL, LLIST_TRACE_ENTER, l, i, 0, 0);
+    size_t hops = 0;
+    lnode_t *node = lnode_get(l, i, &hops); // returns last if out of range
+    if (node != NULL)
+        index_drop(l);
+    LLIST_TRACE_CLOCK(t0);
+    void *ret = lnode_free(l, node);
+    LLIST_TRACE_CLOCK(t1);
+    LLIST_TRACE_EVENT(LLIST_OP_DEL, LLIST_TRACE_EXIT, l, i, hops, t1 - t0);
+    return ret;
+}
+
+// Clears the given linked list, removing and freeing every element. Arena 
+// lists release their chunks instead, without visiting each element. 
+//
+// PARAMS: 
+// l - the linked list to free
+void llist_clear(llist_t *l) {
+    LLIST_TRACE_EVENT(LLIST_OP_CLEAR, LLIST_TRACE_ENTER, l, 0, 0, 0);
+    index_drop(l);
+    if (l != NULL && l->chunk != 0) {
+        arena_free(l);
+        l->bytes = 0;                   // elements went with the chunks
+    } else if (l != NULL) {
+        lnode_t *current = l->head;
+        while (current != NULL) {
+            lnode_t *n = current;
+            current = current->next;
+            lnode_free_whole(l, n);
+        }
+        pool_drop(l);
+    }
+    if (l != NULL) {
+        slot_free(l);                   // stales every handle
+        l->len = 0;
+        l->head = NULL;
+        l->tail = NULL;
+    }
+    LLIST_TRACE_EVENT(LLIST_OP_CLEAR, LLIST_TRACE_EXIT, l, 0, 0, 0);
+}
+
+// Add a new element into the given linked list, like llist_add, and returns 
+// a handle to its node. The first handle allocates the slot table of the 
+// list, which grows as more handles are live at once. 
+//
+// PARAMS: 
+// l   - the linked list to have the element added
+// d   - the element to add
+// n   - the size of the element
+// out - where to store the handle
+//
+// RET: 
+// Zero on success, non-zero on error. 
+int llist_add_handle(llist_t *l, const void *d, size_t n, 
+        llist_handle_t *out) {
+    if (l == NULL || d == NULL || out == NULL)
+        return LLIST_NULL_ERR;
+
+    out->slot = 0;
+    out->gen = 0;
+    lnode_t *node = NULL;
+    int ret = slot_reserve(l);
+    if (ret == LLIST_OK)
+        ret = llist_add_node(l, d, n, &node);
+    if (ret == LLIST_OK)
+        slot_bind(l, node, out);
+    return ret;
+}
+
+// Inserts a new element into the given linked list, like llist_ins, and 
+// returns a handle to its node, taking a slot as llist_add_handle does. 
+//
+// PARAMS: 
+// l   - the linked list to have the element inserted
+// d   - the element to insert
+// n   - the size of the element
+// i   - the index in the linked list to insert to
+// out - where to store the handle
+//
+// RET: 
+// Zero on success, non-zero on error. 
+int llist_ins_handle(llist_t *l, const void *d, size_t n, size_t i, 
+        llist_handle_t *out) {
+    if (l == NULL || out == NULL)
+        return LLIST_NULL_ERR;
+
+    out->slot = 0;
+    out->gen = 0;
+    lnode_t *node = NULL;
+    int ret = slot_reserve(l);
+    if (ret == LLIST_OK)
+        ret = llist_ins_node(l, d, n, i, &node);
+    if (ret == LLIST_OK)
+        slot_bind(l, node, out);
+    return ret;
+}
+
+// Returns the element named by the given handle in O(1). The handle must 
+// come from this list. Handles to elements deleted, split off or cleared are 
+// rejected. 
+//
+// PARAMS: 
+// l - the linked list holding the element
+// h - the handle of the element
+//
+// RET: 
+// The element of the handle, or NULL if any error occurred. 
+void *llist_get_handle(const llist_t *l, llist_handle_t h) {
+    if (l == NULL)
+        return NULL;
+
+    LLIST_STAT(l, gets++);
+    LLIST_TRACE_EVENT(LLIST_OP_GET, LLIST_TRACE_ENTER, l, SIZE_MAX, 0, 0);
+    lnode_t *node = handle_node(l, h);
+    void *ret = (node != NULL) ? lnode_data(node) : NULL;
+    LLIST_TRACE_EVENT(LLIST_OP_GET, LLIST_TRACE_EXIT, l, SIZE_MAX, 0, 0);
+    return ret;
+}
+
+// Deletes the element named by the given handle in O(1), like llist_del. The 
+// handle must come from this list, and is stale afterwards. Stale handles 
+// are rejected. 
+//
+// PARAMS: 
+// l - the linked list to have the element deleted
+// h - the handle of the element
+//
+// RET: 
+// The element that just got removed, or NULL if any error occurred. 
+void *llist_del_handle(llist_t *l, llist_handle_t h) {
+    lnode_t *node = handle_node(l, h);
+    if (node == NULL)
+        return NULL;
+
+    LLIST_STAT(l, dels++);
+    LLIST_TRACE_EVENT(LLIST_OP_DEL, LLIST_TRACE_ENTER, l, SIZE_MAX, 0, 0);
+    index_drop(l);
+    LLIST_TRACE_CLOCK(t0);
+    void *ret = lnode_free(l, node);
+    LLIST_TRACE_CLOCK(t1);
+    LLIST_TRACE_EVENT(LLIST_OP_DEL, LLIST_TRACE_EXIT, l, SIZE_MAX, 0, t1 - t0);
+    return ret;
+}
+
+// Moves the element named by a handle in front of another in O(1). No 
+// element is copied, and both handles stay valid. Both handles must come 
+// from this list. Stale handles are rejected. 
+//
+// PARAMS: 
+// l   - the linked list holding the elements
+// h   - the handle of the element to move
+// pos - the handle to move in front of, or one with slot 0 for the tail
+//
+// RET: 
+// Zero on success, LLIST_HANDLE_ERR if a handle is stale, other non-zero on 
+// error. 
+int llist_move_before(llist_t *l, llist_handle_t h, llist_handle_t pos) {
+    if (l == NULL || h.slot == 0)
+        return LLIST_NULL_ERR;
+    lnode_t *node = handle_node(l, h);
+    lnode_t *at = handle_node(l, pos);
+    if (node == NULL || (at == NULL && pos.slot != 0))
+        return LLIST_HANDLE_ERR;
+    if (node == at || node->next == at)
+        return LLIST_OK;                // already in place
+
+    LLIST_TRACE_EVENT(LLIST_OP_MOVE, LLIST_TRACE_ENTER, l, SIZE_MAX, 0, 0);
+    index_drop(l);
+    llist_unlink(l, node);
+    node->next = at;
+    node->prev = (at != NULL) ? at->prev : l->tail;
+    if (node->prev != NULL)
+        node->prev->next = node;
+    else
+        l->head = node;
+    if (at != NULL)
+        at->prev = node;
+    else
+        l->tail = node;
+    l->len++;
+    LLIST_TRACE_EVENT(LLIST_OP_MOVE, LLIST_TRACE_EXIT, l, SIZE_MAX, 0, 0);
+    return LLIST_OK;
+}
+
+// Reverses the given linked list in place by swapping the links of every 
+// node. No element is copied. 
+//
+// PARAMS: 
+// l - the linked list to reverse
+//
+// RET: 
+// Zero on success, non-zero on error. 
+int llist_reverse(llist_t *l) {
+    if (l == NULL)
+        return LLIST_NULL_ERR;
+
+    LLIST_TRACE_EVENT(LLIST_OP_REVERSE, LLIST_TRACE_ENTER, l, 0, 0, 0);
+    index_drop(l);
+    lnode_t *current = l->head;
+    while (current != NULL) {
+        lnode_t *next = current->next;
+        current->next = current->prev;
+        current->prev = next;
+        current = next;
+    }
+    lnode_t *head = l->head;
+    l->head = l->tail;
+    l->tail = head;
+    LLIST_TRACE_EVENT(LLIST_OP_REVERSE, LLIST_TRACE_EXIT, l, 0, 0, 0);
+    return LLIST_OK;
+}
+
+// Rotates the given linked list left, so that the element at index k becomes 
+// the head. Only the new head is looked up, then the ends are relinked. 
+//
+// PARAMS: 
+// l - the linked list to rotate
+// k - the number of places to rotate, taken modulo the list size
+//
+// RET: 
+// Zero on success, non-zero on error. 
+int llist_rotate(llist_t *l, size_t k) {
+    if (l == NULL)
+        return LLIST_NULL_ERR;
+
+    LLIST_TRACE_EVENT(LLIST_OP_ROTATE, LLIST_TRACE_ENTER, l, k, 0, 0);
+    size_t hops = 0;
+    if (l->len != 0 && k % l->len != 0) {
+        lnode_t *head = lnode_get(l, k % l->len, &hops);
+        index_drop(l);
+        l->tail->next = l->head;        // close the ring, then cut it
+        l->head->prev = l->tail;
+        l->tail = head->prev;
+        l->tail->next = NULL;
+        head->prev = NULL;
+        l->head = head;
+    }
+    LLIST_TRACE_EVENT(LLIST_OP_ROTATE, LLIST_TRACE_EXIT, l, k, hops, 0);
+    return LLIST_OK;
+}
+
+// Splits the given linked list at an index, moving every element from that 
+// index on into another list, which is initialised first. No element is 
+// copied. Handles to the moved elements go stale, so if the list has a slot 
+// table the moved elements are walked to release their slots. Both lists 
+// share the node pool afterwards, so they must not be mutated concurrently. 
+// Arena lists can not be split, as their elements share chunks. 
+//
+// PARAMS: 
+// l   - the linked list to split
+// i   - the index of the first element to move
+// out - the linked list receiving the elements
+//
+// RET: 
+// Zero on success, LLIST_MODE_ERR if the list is an arena list, other 
+// non-zero on error. 
+int llist_split(llist_t *l, size_t i, llist_t *out) {
+    if (l == NULL || out == NULL || l == out)
+        return LLIST_NULL_ERR;
+
+    LLIST_TRACE_EVENT(LLIST_OP_SPLIT, LLIST_TRACE_ENTER, l, i, 0, 0);
+    int ret = (l->chunk != 0) ? LLIST_MODE_ERR : LLIST_OK;
+    if (ret == LLIST_OK) {
+        llist_init(out);
+        out->metered = l->metered;
+    }
+    if (ret != LLIST_OK || i >= l->len) {
+        LLIST_TRACE_EVENT(LLIST_OP_SPLIT, LLIST_TRACE_EXIT, l, i, 0, 0);
+        return ret;
+    }
+
+    index_drop(l);
+    size_t bytes = 0;                   // sums of the shorter side
+    size_t heap = 0;
+    size_t hops = (i < l->len - i) ? i : (l->len - i);
+    lnode_t *n = (i < l->len - i) ? l->head : l->tail;
+    for (size_t j = 0; j < hops; j++) {
+        bytes += n->size;
+        heap += lnode_cost(l, n->size, n->slotted);
+        n = (i < l->len - i) ? n->next : n->prev;
+    }
+    lnode_t *first = n;                 // walked the kept prefix
+    if (i < l->len - i) {
+        bytes = l->bytes - bytes;
+        heap = l->heap - slot_cost(l) - heap;   // the table stays in l
+    } else {                            // walked the moved suffix
+        first = n->next;
+    }
+    if (l->slots != NULL) {
+        for (n = first; n != NULL; n = n->next)
+            slot_release(l, n);
+    }
+
+    out->head = first;
+    out->tail = l->tail;
+    out->len = l->len - i;
+    out->bytes = bytes;
+    out->heap = heap;
+    out->pool = l->pool;                // both lists hold nodes of the pool
+    out->pool->refs++;
+    l->tail = first->prev;
+    l->len = i;
+    l->bytes -= bytes;
+    l->heap -= heap;
+    first->prev = NULL;
+    if (l->tail != NULL)
+        l->tail->next = NULL;
+    else
+        l->head = NULL;
+    LLIST_TRACE_EVENT(LLIST_OP_SPLIT, LLIST_TRACE_EXIT, l, i, hops, 0);
+    return LLIST_OK;
+}
+
+// Initialises a linked list as a deep copy of another, in the same mode. A 
+// heap list is copied node by node in one pass, so its elements are owned as 
+// usual. An arena list is copied as by llist_clone_arena. 
+//
+// PARAMS: 
+// dst - the linked list to initialise as the copy
+// src - the linked list to copy
+//
+// RET: 
+// Zero on success, non-zero on error. 
+int llist_clone(llist_t *dst, const llist_t *src) {
+    if (dst == NULL || src == NULL || dst == src)
+        return LLIST_NULL_ERR;
+    if (src->chunk != 0)
+        return llist_clone_arena(dst, src);
+
+    llist_init(dst);
+    LLIST_TRACE_EVENT(LLIST_OP_CLONE, LLIST_TRACE_ENTER, src, 0, 0, 0);
+    int ret = lnode_copy_all(dst, src);
+    if (ret != LLIST_OK)
+        llist_clear(dst);
+    LLIST_TRACE_EVENT(LLIST_OP_CLONE, LLIST_TRACE_EXIT, dst, 0, 0, 0);
+    return ret;
+}
+
+// Initialises a linked list as a deep copy of another. The copy is an arena 
+// list whose nodes and elements are laid out in order in one chunk, sized from 
+// the totals of the source, so it is built in one pass and one allocation. 
+// Like any arena list, its elements are only freed when it is cleared. 
+//
+// PARAMS: 
+// dst - the linked list to initialise as the copy
+// src - the linked list to copy
+//
+// RET: 
+// Zero on success, non-zero on error. 
+int llist_clone_arena(llist_t *dst, const llist_t *src) {
+    if (dst == NULL || src == NULL || dst == src)
+        return LLIST_NULL_ERR;
+
+    size_t cap = src->len * (LNODE_HDR + LLIST_ARENA_ALIGN - 1) + 
+        src->bytes;                     // worst case padding of each node
+    llist_init_arena(dst, cap);
+    LLIST_TRACE_EVENT(LLIST_OP_CLONE, LLIST_TRACE_ENTER, src, 0, 0, 0);
+    int ret = lnode_copy_all(dst, src);
+    dst->chunk = LLIST_ARENA_CHUNK;     // later adds use normal chunks
+    if (ret != LLIST_OK)
+        llist_clear(dst);
+    LLIST_TRACE_EVENT(LLIST_OP_CLONE, LLIST_TRACE_EXIT, dst, 0, 0, 0);
+    return ret;
+}
+
+// Freezes the given linked list, indexing every node in one pass so that 
+// lookups by index take O(1) time. The next change to the list drops the 
+// index. Freezing an already frozen list does nothing. 
+//
+// PARAMS: 
+// l - the linked list to freeze
+//
+// RET: 
+// Zero on success, non-zero on error. 
+int llist_freeze(llist_t *l) {
+    if (l == NULL)
+        return LLIST_NULL_ERR;
+
+    LLIST_TRACE_EVENT(LLIST_OP_FREEZE, LLIST_TRACE_ENTER, l, 0, 0, 0);
+    int ret = LLIST_OK;
+    if (l->index == NULL && l->len != 0) {     // not frozen yet
+        l->index = malloc(l->len * sizeof *l->index);
+        if (l->index == NULL) {
+            ret = LLIST_ALLOC_ERR;
+        } else {
+            mem_charge(l, alloc_est(l->len * sizeof *l->index));
+            lnode_t *n = l->head;
+            for (size_t i = 0; i < l->len; i++, n = n->next)
+                l->index[i] = n;
+        }
+    }
+    LLIST_TRACE_EVENT(LLIST_OP_FREEZE, LLIST_TRACE_EXIT, l, 0, 0, 0);
+    return ret;
+}
+
+// Drops the index of the given linked list, if it is frozen. 
+//
+// PARAMS: 
+// l - the linked list to thaw
+void llist_thaw(llist_t *l) {
+    if (l != NULL) {
+        LLIST_TRACE_EVENT(LLIST_OP_THAW, LLIST_TRACE_ENTER, l, 0, 0, 0);
+        index_drop(l);
+        LLIST_TRACE_EVENT(LLIST_OP_THAW, LLIST_TRACE_EXIT, l, 0, 0, 0);
+    }
+}
+
+// Returns the memory footprint of the given linked list in O(1), from totals 
+// kept up to date by every add and delete. 
+//
+// PARAMS: 
+// l   - the linked list to measure
+// out - where to store the footprint
+//
+// RET: 
+// Zero on success, non-zero on error. 
+int llist_memory_usage(const llist_t *l, llist_memory_t *out) {
+    if (l == NULL || out == NULL)
+        return LLIST_NULL_ERR;
+
+    out->nodes = l->len * offsetof(lnode_t, t);
+    out->payload = l->bytes;
+    out->overhead = l->heap - out->nodes - out->payload;
+    return LLIST_OK;
+}
+
+// Sets a memory budget shared by every linked list initialised afterwards. 
+// Adding or inserting an element fails with LLIST_BUDGET_ERR when its 
+// estimated footprint would push the total over the budget. The total is not 
+// synchronised, so metered lists must not be mutated concurrently. 
+//
+// PARAMS: 
+// bytes - the budget in bytes, or 0 to disable it
+void llist_set_budget(size_t bytes) {
+    budget = bytes;
+}
+
+// Returns the estimated bytes held by every linked list charged to the 
+// budget. 
+//
+// RET: 
+// The bytes charged to the budget. 
+size_t llist_budget_used(void) {
+    return budget_used;
+}
+
+// Copies the operation counters of the given linked list. Without 
+// LLIST_STATS, every counter reads as zero. 
+//
+// PARAMS: 
+// l   - the linked list to read the counters of
+// out - where to store the counters
+//
+// RET: 
+// Zero on success, non-zero on error. 
+int llist_stats(const llist_t *l, llist_stats_t *out) {
+    if (l == NULL || out == NULL)
+        return LLIST_NULL_ERR;
+
+#ifdef LLIST_STATS
+    *out = l->stats;
+#else
+    memset(out, 0, sizeof *out);
+#endif
+    return LLIST_OK;
+}
+
+// Resets the operation counters of the given linked list to zero. 
+//
+// PARAMS: 
+// l - the linked list to reset the counters of
+void llist_stats_reset(llist_t *l) {
+#ifdef LLIST_STATS
+    if (l != NULL)
+        memset(&l->stats, 0, sizeof l->stats);
+#else
+    (void)l;
+#endif
+}
+
+// Sets the hook called on entry and exit of the public llist_* functions. 
+// Events are only emitted when the library is compiled with LLIST_TRACE, 
+// otherwise the probes compile away. The hook should be set before lists are 
+// used from several threads. 
+//
+// PARAMS: 
+// fn  - the hook to call, or NULL to disable tracing
+// ctx - the context passed to fn
+void llist_set_trace(llist_trace_fn fn, void *ctx) {
+    trace_fn = fn;
+    trace_ctx = ctx;
+}
+
+#ifdef LLIST_TRACE
+// Passes a trace event to the hook, if one is set. 
+//
+// PARAMS: 
+// op    - the LLIST_OP_* of the traced function
+// phase - LLIST_TRACE_ENTER or LLIST_TRACE_EXIT
+// l     - the linked list operated on
+// i     - the index operated on
+// hops  - the pointer hops of the index lookup
+// ns    - the time spent in the allocator
+void llist_trace_emit(int op, int phase, const llist_t *l, size_t i, 
+        size_t hops, uint64_t ns) {
+    if (trace_fn != NULL) {
+        llist_trace_t ev = {op, phase, l, i, (l != NULL) ? l->len : 0, hops, 
+            ns};
+        trace_fn(&ev, trace_ctx);
+    }
+}
+
+// Returns a monotonic timestamp for measuring allocation latency. 
+//
+// RET: 
+// The current monotonic time in nanoseconds. 
+uint64_t llist_trace_now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000u + (uint64_t)ts.tv_nsec;
+}
+#endif
+
+// Returns whether the given linked list is empty or not. 
+//
+// PARAMS: 
+// l - the linked list to check
+//
+// RET: 
+// True (1) if the linked list is empty, 0 (false) otherwise. 
+static inline _Bool llist_empty(const llist_t *l) {
+    return (l == NULL || l->len == 0);
+}
+
+// Adds a new element to the tail of the given linked list, the work behind 
+// llist_add. 
+//
+// PARAMS: 
+// l   - the linked list to have the element added
+// d   - the element to add, or NULL to leave it unset
+// n   - the size of the element
+// out - where to store the new node, or NULL
+//
+// RET: 
+// Zero on success, non-zero on error. 
+static int llist_add_node(llist_t *l, const void *d, size_t n, 
+        lnode_t **out) {
+    if (l == NULL || n == 0 || n > LLIST_ELEM_MAX)
+        return LLIST_NULL_ERR;
+
+    LLIST_TRACE_EVENT(LLIST_OP_ADD, LLIST_TRACE_ENTER, l, l->len, 0, 0);
+    LLIST_STAT(l, adds++);
+    index_drop(l);
+    int ret = LLIST_ALLOC_ERR;
+    if (!budget_allows(l, n, out != NULL))
+        ret = LLIST_BUDGET_ERR;
+    LLIST_TRACE_CLOCK(t0);
+    lnode_t *add = (ret == LLIST_ALLOC_ERR) ? 
+        lnode_new(l, d, n, out != NULL) : NULL;
+    LLIST_TRACE_CLOCK(t1);
+    if (add != NULL) {
+        ret = LLIST_OK;
+        llist_link_tail(l, add);
+    }
+    if (out != NULL)
+        *out = add;
+    LLIST_TRACE_EVENT(LLIST_OP_ADD, LLIST_TRACE_EXIT, l, 
+        (ret == LLIST_OK) ? l->len - 1 : l->len, 0, t1 - t0);
+    return ret;
+}
+
+// Inserts a new element into the given linked list, the work behind 
+// llist_ins. 
+//
+// PARAMS: 
+// l   - the linked list to have the element inserted
+// d   - the element to insert
+// n   - the size of the element
+// i   - the index in the linked list to insert to
+// out - where to store the new node, or NULL
+//
+// RET: 
+// Zero on success, non-zero on error. 
+static int llist_ins_node(llist_t *l, const void *d, size_t n, size_t i, 
+        lnode_t **out) {
+    if (l == NULL || d == NULL || n == 0 || n > LLIST_ELEM_MAX)
         return LLIST_NULL_ERR;
-    if (l->len == 0 || i >= l->len)
-        return llist_add(l, d, n);      // let llist_add handle out of range
 
+    LLIST_TRACE_EVENT(LLIST_OP_INS, LLIST_TRACE_ENTER, l, i, 0, 0);
+    LLIST_STAT(l, inss++);
+    index_drop(l);
     int ret = LLIST_ALLOC_ERR;
-    lnode_t *ins = lnode_new(d, n);
+    if (!budget_allows(l, n, out != NULL))
+        ret = LLIST_BUDGET_ERR;
+    size_t hops = 0;
+    LLIST_TRACE_CLOCK(t0);
+    lnode_t *ins = (ret == LLIST_ALLOC_ERR) ? 
+        lnode_new(l, d, n, out != NULL) : NULL;
+    LLIST_TRACE_CLOCK(t1);
     if (ins != NULL) {
         ret = LLIST_OK;
-        if (i == 0) {       // insert to head
+        if (i >= l->len) {              // insert to tail
+            llist_link_tail(l, ins);
+        } else if (i == 0) {            // insert to head
             l->head->prev = ins;
             ins->next = l->head;
             l->head = l->head->prev;
-        } else {            // insert to mid
-            lnode_t *bef = lnode_get(l, i - 1);
+            l->len++;
+        } else {                        // insert to mid
+            lnode_t *bef = lnode_get(l, i - 1, &hops);
             lnode_t *aft = bef->next;
             bef->next = ins;
             ins->prev = bef;
             aft->prev = ins;
             ins->next = aft;
+            l->len++;
         }
-        l->len++;
     }
+    if (out != NULL)
+        *out = ins;
+    LLIST_TRACE_EVENT(LLIST_OP_INS, LLIST_TRACE_EXIT, l, i, hops, t1 - t0);
     return ret;
 }
 
-// Deletes the element at the given index in the specified linked list. If the 
-// given index is out of range, then the last element will be deleted. 
+// Unlinks the given node from the given linked list, fixing the head and tail 
+// from the links of the node. The node is not freed. 
 //
 // PARAMS: 
-// l - the linked list to have the element deleted
-// i - the index of the element
+// l - the linked list holding the node
+// n - the node to unlink
+static void llist_unlink(llist_t *l, lnode_t *n) {
+    if (n->prev != NULL)
+        n->prev->next = n->next;
+    else
+        l->head = n->next;
+    if (n->next != NULL)
+        n->next->prev = n->prev;
+    else
+        l->tail = n->prev;
+    n->prev = NULL;
+    n->next = NULL;
+    l->len--;
+}
+
+// Drops the index of the given linked list, if it is frozen, the untraced 
+// work behind llist_thaw. 
+//
+// PARAMS: 
+// l - the linked list to thaw
+static void index_drop(llist_t *l) {
+    if (l != NULL && l->index != NULL) {
+        mem_release(l, alloc_est(l->len * sizeof *l->index));
+        free(l->index);
+        l->index = NULL;
+    }
+}
+
+// Links the given node after the tail of the given linked list. 
+//
+// PARAMS: 
+// l - the linked list to hold the node
+// n - the unlinked node to add
+static void llist_link_tail(llist_t *l, lnode_t *n) {
+    if (l->len == 0) {          // list is empty
+        l->head = n;
+        l->tail = n;
+    } else {
+        l->tail->next = n;
+        n->prev = l->tail;
+        l->tail = n;
+    }
+    l->len++;
+}
+
+// Returns the node named by the given handle. Only the slot table of the 
+// list is read, so a handle to a freed node is rejected safely. 
+//
+// PARAMS: 
+// l - the linked list owning the slot table
+// h - the handle to resolve
 //
 // RET: 
-// The element that just got removed. 
-void *llist_del(llist_t *l, size_t i) {
-    lnode_t *node = lnode_get(l, i);    // returns last if out of range
-    if (node != NULL) {
-        if (l->len == 1) {              // final element, clear list
-            l->head = NULL;
-            l->tail = NULL;
-        } else if (i == 0) {            // first element, update head
-            l->head = l->head->next;
-            l->head->prev = NULL;
-        } else if (i >= l->len - 1) {   // last element, update tail
-            l->tail = l->tail->prev;
-            l->tail->next = NULL;
-        } else {                        // delete mid, update link
-            node->prev->next = node->next;
-            node->next->prev = node->prev;
-        }
-        l->len--;
+// The node of the handle, or NULL if the handle is empty or stale. 
+static lnode_t *handle_node(const llist_t *l, llist_handle_t h) {
+    if (l == NULL || h.slot == 0 || h.slot > l->top)
+        return NULL;
+    const lslot_t *s = &l->slots[h.slot];
+    return (s->node != NULL && s->gen == h.gen) ? s->node : NULL;
+}
+
+// Makes sure the slot table of the given linked list has a free slot, 
+// allocating the table or doubling it when every slot is taken. 
+//
+// PARAMS: 
+// l - the linked list owning the slot table
+//
+// RET: 
+// Zero on success, non-zero on error. 
+static int slot_reserve(llist_t *l) {
+    if (l->free != 0 || l->top + 1 < l->cap)
+        return LLIST_OK;
+    if (l->cap > UINT32_MAX / 2)
+        return LLIST_ALLOC_ERR;
+
+    uint32_t cap = (l->cap == 0) ? LSLOT_MIN : l->cap * 2;
+    size_t old = slot_cost(l);
+    size_t cost = alloc_est(cap * sizeof *l->slots);
+    if (!budget_fits(l, cost - old))
+        return LLIST_BUDGET_ERR;
+    lslot_t *slots = realloc(l->slots, cap * sizeof *slots);
+    if (slots == NULL)
+        return LLIST_ALLOC_ERR;
+    mem_release(l, old);
+    mem_charge(l, cost);
+    l->slots = slots;
+    l->cap = cap;
+    return LLIST_OK;
+}
+
+// Gives a free slot to the given node, under a new generation, and stores a 
+// handle to it. A slot must have been reserved. 
+//
+// PARAMS: 
+// l   - the linked list owning the slot table
+// n   - the node to name
+// out - where to store the handle
+static void slot_bind(llist_t *l, lnode_t *n, llist_handle_t *out) {
+    uint32_t s = l->free;                   // slot 0 is never used
+    if (s != 0)
+        l->free = l->slots[s].next;
+    else
+        s = ++l->top;
+    l->slots[s].node = n;
+    l->slots[s].gen = ++l->gen;
+    *lnode_slot(n) = s;
+    out->slot = s;
+    out->gen = l->gen;
+}
+
+// Frees the slot of the given node, if it has one, which stales every handle 
+// to the node. 
+//
+// PARAMS: 
+// l - the linked list owning the slot table
+// n - the node losing its slot
+static void slot_release(llist_t *l, lnode_t *n) {
+    uint32_t *s = n->slotted ? lnode_slot(n) : NULL;
+    if (s != NULL && *s != 0) {
+        l->slots[*s].node = NULL;
+        l->slots[*s].next = l->free;
+        l->free = *s;
+        *s = 0;
     }
-    return lnode_free(node);
 }
 
-// Clears the given linked list, removing and freeing every element. 
+// Frees the slot table of the given linked list. The generation is kept, so 
+// handles from before stay stale once the table is allocated again. 
 //
 // PARAMS: 
-// l - the linked list to free
-void llist_clear(llist_t *l) {
-    if (!llist_empty(l)) {
-        lnode_t *current = l->head;
+// l - the linked list owning the slot table
+static void slot_free(llist_t *l) {
+    mem_release(l, slot_cost(l));
+    free(l->slots);
+    l->slots = NULL;
+    l->cap = 0;
+    l->top = 0;
+    l->free = 0;
+}
+
+// Returns the estimated bytes the slot table of a linked list takes from 
+// malloc. 
+//
+// PARAMS: 
+// l - the linked list owning the slot table
+//
+// RET: 
+// The estimated bytes of the table, 0 if it has none. 
+static size_t slot_cost(const llist_t *l) {
+    return (l->slots != NULL) ? alloc_est(l->cap * sizeof *l->slots) : 0;
+}
+
+// Bump allocates a block of memory from the given chunk, padding it to 
+// start at the given phase of the given alignment. 
+//
+// PARAMS: 
+// c     - the chunk to allocate from, or NULL
+// n     - the size of the block
+// align - the alignment, a power of two
+// phase - the remainder the block address leaves modulo align
+//
+// RET: 
+// The block allocated, or NULL if the chunk is full. 
+static void *chunk_bump(lchunk_t *c, size_t n, size_t align, size_t phase) {
+    if (c == NULL)
+        return NULL;
+    uintptr_t top = (uintptr_t)(c + 1) + c->used;
+    size_t pad = (size_t)((phase - top) & (align - 1));
+    if (c->cap - c->used < pad + n)
+        return NULL;
+    c->used += pad + n;
+    return (void *)(top + pad);
+}
+
+// Bump allocates a block of memory from the arena of the given linked list, 
+// attaching a new chunk if the newest one is full. 
+//
+// PARAMS: 
+// l     - the arena linked list to allocate from
+// n     - the size of the block
+// align - the alignment, at most LLIST_ARENA_ALIGN
+// phase - the remainder the block address leaves modulo align
+//
+// RET: 
+// The block allocated, or NULL if any error occurred. 
+static void *arena_alloc(llist_t *l, size_t n, size_t align, size_t phase) {
+    void *ret = chunk_bump(l->arena, n, align, phase);
+    if (ret != NULL)
+        return ret;
+
+    size_t cap = (n + LLIST_ARENA_ALIGN > l->chunk) ? 
+        (n + LLIST_ARENA_ALIGN) : l->chunk;
+    lchunk_t *c = malloc(sizeof *c + cap);
+    if (c == NULL)
+        return NULL;
+    LLIST_STAT(l, alloc_bytes += sizeof *c + cap);
+    mem_charge(l, alloc_est(sizeof *c + cap));
+    c->next = l->arena;
+    c->used = 0;
+    c->cap = cap;
+    l->arena = c;
+    return chunk_bump(c, n, align, phase);  // fits in the new chunk
+}
+
+// Frees every chunk in the arena of the given linked list. 
+//
+// PARAMS: 
+// l - the arena linked list to free
+static void arena_free(llist_t *l) {
+    lchunk_t *current = l->arena;
+    while (current != NULL) {
+        lchunk_t *c = current;
+        current = current->next;
+        LLIST_STAT(l, free_bytes += sizeof *c + c->cap);
+        mem_release(l, alloc_est(sizeof *c + c->cap));
+        free(c);
+    }
+    l->arena = NULL;
+}
+
+// Takes a node for an element of the given size from the pool of the given 
+// heap linked list, creating the pool or attaching a new slab as needed. 
+// Slabs start at LPOOL_SLAB_MIN bytes and double up to LPOOL_SLAB_MAX. 
+//
+// PARAMS: 
+// l       - the heap linked list to allocate from
+// n       - the size of the element
+// slotted - whether the node needs room for a handle slot
+//
+// RET: 
+// The node taken, or NULL if any error occurred. 
+static lnode_t *pool_take(llist_t *l, size_t n, bool slotted) {
+    lpool_t *p = l->pool;
+    if (p == NULL) {
+        p = malloc(sizeof *p);
+        if (p == NULL)
+            return NULL;
+        p->slabs = NULL;
+        for (size_t i = 0; i < LPOOL_CLASSES; i++)
+            p->free[i] = NULL;
+        p->refs = 1;
+        l->pool = p;
+    }
+
+    size_t stride = lnode_stride(l, n, slotted);
+    size_t cls = stride / 8 - LNODE_BASE / 8;
+    lnode_t *ret = p->free[cls];
+    if (ret != NULL) {
+        p->free[cls] = ret->next;
+        return ret;
+    }
+    size_t phase = 0;
+    size_t align = lnode_align(l, n, &phase);
+    ret = chunk_bump(p->slabs, stride, align, phase);
+    if (ret == NULL) {
+        size_t cap = (p->slabs == NULL) ? LPOOL_SLAB_MIN : 2 * p->slabs->cap;
+        cap = (cap > LPOOL_SLAB_MAX) ? LPOOL_SLAB_MAX : cap;
+        lchunk_t *c = malloc(sizeof *c + cap);
+        if (c == NULL)
+            return NULL;
+        c->next = p->slabs;
+        c->used = 0;
+        c->cap = cap;
+        p->slabs = c;
+        ret = chunk_bump(c, stride, align, phase);
+    }
+    return ret;
+}
+
+// Gives a node back to the pool of the given heap linked list, for reuse by 
+// a node of the same size class. 
+//
+// PARAMS: 
+// l - the heap linked list owning the node
+// n - the node to give back
+static void pool_put(llist_t *l, lnode_t *n) {
+    size_t cls = lnode_stride(l, n->size, n->slotted) / 8 - LNODE_BASE / 8;
+    n->next = l->pool->free[cls];
+    l->pool->free[cls] = n;
+}
+
+// Drops the reference of the given heap linked list to its pool, freeing 
+// every slab once no list uses the pool. 
+//
+// PARAMS: 
+// l - the heap linked list to detach
+static void pool_drop(llist_t *l) {
+    lpool_t *p = l->pool;
+    l->pool = NULL;
+    if (p != NULL && --p->refs == 0) {
+        lchunk_t *current = p->slabs;
         while (current != NULL) {
-            lnode_t *n = current;
+            lchunk_t *c = current;
             current = current->next;
-            lnode_free_whole(n);
+            free(c);
         }
-        l->len = 0;
-        l->head = NULL;
-        l->tail = NULL;
+        free(p);
     }
 }
 
-// Returns whether the given linked list is empty or not. 
+// Returns the usable size malloc is estimated to reserve for a request, 
+// assuming a size header and 16 byte granularity as in common allocators. 
 //
 // PARAMS: 
-// l - the linked list to check
+// n - the size requested
 //
 // RET: 
-// True (1) if the linked list is empty, 0 (false) otherwise. 
-static inline _Bool llist_empty(const llist_t *l) {
-    return (l == NULL || l->len == 0);
+// The estimated bytes reserved. 
+static size_t alloc_est(size_t n) {
+    size_t ret = (n + sizeof(size_t) + 15) & ~(size_t)15;
+    return (ret < 32) ? 32 : ret;
+}
+
+// Returns the bytes a node holding an element of the given size needs. 
+// Tiny elements end the node in t, other inline ones in u, and larger ones 
+// leave only the pointer in u. 
+//
+// PARAMS: 
+// n       - the size of the element
+// slotted - whether the node needs room for a handle slot
+//
+// RET: 
+// The length of the node. 
+static size_t lnode_len(size_t n, bool slotted) {
+    if (n <= LLIST_TINY_MAX)
+        return LNODE_BASE + (slotted ? sizeof(void *) : 0);
+    if (n <= LLIST_INLINE_MAX)
+        return (LNODE_BASE + n + 7) & ~(size_t)7;
+    return LNODE_BASE + sizeof(void *);
+}
+
+// Returns the alignment a node holding an element of the given size starts 
+// at. Elements get the alignment a type of their size could need: inline 
+// ones whose size is a multiple of LLIST_ARENA_ALIGN get it in full, and so 
+// do large arena elements, which follow their node at LNODE_HDR. 
+//
+// PARAMS: 
+// l     - the linked list owning the node
+// n     - the size of the element
+// phase - where to store the remainder the node address leaves modulo the
+//         alignment
+//
+// RET: 
+// The alignment of the node. 
+static size_t lnode_align(const llist_t *l, size_t n, size_t *phase) {
+    *phase = 0;
+    if (n <= LLIST_INLINE_MAX && n % LLIST_ARENA_ALIGN == 0) {
+        *phase = (size_t)-LNODE_BASE & (LLIST_ARENA_ALIGN - 1);
+        return LLIST_ARENA_ALIGN;
+    }
+    return (n > LLIST_INLINE_MAX && l->chunk != 0) ? LLIST_ARENA_ALIGN : 8;
+}
+
+// Returns the bytes a node takes in a pool slab, its length rounded up to 
+// its alignment so that nodes of one class stay aligned back to back. 
+//
+// PARAMS: 
+// l       - the linked list owning the node
+// n       - the size of the element
+// slotted - whether the node has room for a handle slot
+//
+// RET: 
+// The stride of the node. 
+static size_t lnode_stride(const llist_t *l, size_t n, bool slotted) {
+    size_t phase = 0;
+    size_t align = lnode_align(l, n, &phase);
+    return (lnode_len(n, slotted) + align - 1) & ~(align - 1);
+}
+
+// Returns where the handle slot of a node made for a handle is kept. 
+//
+// PARAMS: 
+// n - the node, which must have room for a slot
+//
+// RET: 
+// The handle slot of the node. 
+static uint32_t *lnode_slot(lnode_t *n) {
+    return (n->size <= LLIST_TINY_MAX) ? &n->u.slot : &n->t.slot;
 }
 
-// Returns a dynamically allocated linked list node. 
+// Returns the bytes a node takes from its pool or the arena, counting an 
+// element stored outside it. Large arena elements follow their node. 
 //
 // PARAMS: 
-// d - the data in the node
-// n - the size of data
+// l       - the linked list owning the node
+// n       - the size of the element
+// slotted - whether the node has room for a handle slot
+//
+// RET: 
+// The bytes requested for the node and its element. 
+static size_t lnode_span(const llist_t *l, size_t n, bool slotted) {
+    if (n > LLIST_INLINE_MAX)
+        return LNODE_HDR + n;
+    return (l->chunk != 0) ? lnode_len(n, slotted) : 
+        lnode_stride(l, n, slotted);
+}
+
+// Returns the estimated bytes a new node would take from malloc. For heap 
+// lists this is the stride of the node in its pool, plus the block of a 
+// large element, and for arena lists the new chunk, if the newest one can not 
+// hold the node. 
+//
+// PARAMS: 
+// l       - the linked list owning the node
+// n       - the size of the element
+// slotted - whether the node has room for a handle slot
+//
+// RET: 
+// The estimated bytes the node adds to the footprint. 
+static size_t lnode_cost(const llist_t *l, size_t n, bool slotted) {
+    if (l->chunk == 0 && n <= LLIST_INLINE_MAX)
+        return lnode_stride(l, n, slotted);
+    if (l->chunk == 0)
+        return lnode_stride(l, n, slotted) + alloc_est(n);
+
+    n = lnode_span(l, n, slotted);
+    const lchunk_t *c = l->arena;
+    if (c != NULL && c->cap - c->used >= n + LLIST_ARENA_ALIGN)
+        return 0;
+    size_t cap = (n + LLIST_ARENA_ALIGN > l->chunk) ? 
+        (n + LLIST_ARENA_ALIGN) : l->chunk;
+    return alloc_est(sizeof *c + cap);
+}
+
+// Returns whether a new node fits in the global budget. Lists initialised 
+// without a budget always fit. 
+//
+// PARAMS: 
+// l       - the linked list owning the node
+// n       - the size of the element
+// slotted - whether the node needs room for a handle slot
+//
+// RET: 
+// True (1) if the node fits, 0 (false) otherwise. 
+static bool budget_allows(const llist_t *l, size_t n, bool slotted) {
+    if (!l->metered || budget == 0)
+        return true;
+    return budget_fits(l, lnode_cost(l, n, slotted));
+}
+
+// Returns whether the given bytes fit in the global budget. 
+//
+// PARAMS: 
+// l    - the linked list to charge
+// cost - the estimated bytes to take from malloc
+//
+// RET: 
+// True (1) if the bytes fit, 0 (false) otherwise. 
+static bool budget_fits(const llist_t *l, size_t cost) {
+    if (!l->metered || budget == 0)
+        return true;
+    return budget_used <= budget && cost <= budget - budget_used;
+}
+
+// Adds the given bytes to the footprint of a linked list, and to the budget 
+// if the list is metered. 
+//
+// PARAMS: 
+// l - the linked list to charge
+// n - the bytes taken from malloc
+static void mem_charge(llist_t *l, size_t n) {
+    l->heap += n;
+    if (l->metered)
+        budget_used += n;
+}
+
+// Removes the given bytes from the footprint of a linked list, and from the 
+// budget if the list is metered. 
+//
+// PARAMS: 
+// l - the linked list to release from
+// n - the bytes given back to malloc
+static void mem_release(llist_t *l, size_t n) {
+    l->heap -= n;
+    if (l->metered)
+        budget_used -= n;
+}
+
+// Returns a linked list node allocated for the given linked list. Small 
+// elements are stored inline in the node. Larger elements of arena lists 
+// follow the node in the arena, and those of heap lists get their own block. 
+//
+// PARAMS: 
+// l       - the linked list owning the node
+// d       - the data in the node, or NULL to leave it unset
+// n       - the size of data
+// slotted - whether the node needs room for a handle slot
 //
 // RET: 
 // The new node allocated, or NULL if any error occurred. 
-static lnode_t *lnode_new(const void *d, size_t n) {
-    lnode_t *ret = malloc(sizeof *ret);
+static lnode_t *lnode_new(llist_t *l, const void *d, size_t n, bool slotted) {
+    lnode_t *ret = NULL;
+    if (l->chunk != 0) {
+        size_t phase = 0;
+        size_t align = lnode_align(l, n, &phase);
+        ret = arena_alloc(l, lnode_span(l, n, slotted), align, phase);
+    } else {
+        ret = pool_take(l, n, slotted);
+    }
+
     if (ret != NULL) {
         ret->prev = NULL;
         ret->next = NULL;
-        ret->data = malloc(n);
-        if (ret->data == NULL) {
-            free(ret);
+        ret->size = (uint32_t)n;
+        ret->slotted = slotted;
+        if (slotted)
+            *lnode_slot(ret) = 0;
+        if (n > LLIST_INLINE_MAX) {
+            ret->u.ptr = (l->chunk != 0) ? 
+                (unsigned char *)ret + LNODE_HDR : malloc(n);
+        }
+        if (n > LLIST_INLINE_MAX && ret->u.ptr == NULL) {
+            pool_put(l, ret);
             ret = NULL;
         } else {
-            memcpy(ret->data, d, n);
+            if (d != NULL)
+                memcpy(lnode_data(ret), d, n);
+            l->bytes += n;
+            if (l->chunk == 0) {
+                LLIST_STAT(l, alloc_bytes += lnode_span(l, n, slotted));
+                mem_charge(l, lnode_cost(l, n, slotted));
+            }
         }
     }
     return ret;
@@ -204,56 +1412,123 @@ static lnode_t *lnode_new(const void *d, size_t n) {
 // If the index is out of range, the last node will be returned. 
 //
 // PARAMS: 
-// l - the linked list to retrieve the node
-// i - the index of the node
+// l    - the linked list to retrieve the node
+// i    - the index of the node
+// hops - where to store the pointer hops taken, or NULL
 //
 // RET: 
 // The node retrieved, or NULL if any error occurred. 
-static lnode_t *lnode_get(const llist_t *l, size_t i) {
+static lnode_t *lnode_get(const llist_t *l, size_t i, size_t *hops) {
     if (llist_empty(l))
         return NULL;
 
     lnode_t *ret = NULL;
+    size_t steps = 0;
     i = (i >= l->len) ? (l->len - 1) : i;
-    if (i >= l->len / 2) {      // node in upper half
+    if (l->index != NULL) {         // frozen, no walk
+        ret = l->index[i];
+    } else if (i >= l->len / 2) {   // node in upper half
         ret = l->tail;
-        for (size_t j = 0; j < (l->len - i - 1); j++)
+        steps = l->len - i - 1;
+        for (size_t j = 0; j < steps; j++)
             ret = ret->prev;
-    } else {                    // node in lower half
+    } else {                        // node in lower half
         ret = l->head;
-        for (size_t j = 0; j < i; j++)
+        steps = i;
+        for (size_t j = 0; j < steps; j++)
             ret = ret->next;
     }
+    if (hops != NULL)
+        *hops = steps;
+
+#ifdef LLIST_STATS
+    size_t bucket = 0;
+    for (size_t k = i; k != 0 && bucket < LLIST_STATS_BUCKETS - 1; k >>= 1)
+        bucket++;
+    LLIST_STAT(l, lookups++);
+    LLIST_STAT(l, hops += steps);
+    LLIST_STAT(l, hist[bucket]++);
+    if (steps > l->stats.max_hops)
+        LLIST_STAT(l, max_hops = steps);
+#endif
     return ret;
 }
 
-// Frees the given linked list node and the element inside. 
+// Appends a copy of every element of one linked list to another, in order. 
+// Each node is checked against the budget, so for an arena list the first 
+// node is charged the whole chunk. 
 //
 // PARAMS: 
+// dst - the linked list to append the copies to
+// src - the linked list to copy
+//
+// RET: 
+// Zero on success, non-zero on error. 
+static int lnode_copy_all(llist_t *dst, const llist_t *src) {
+    for (lnode_t *n = src->head; n != NULL; n = n->next) {
+        if (!budget_allows(dst, n->size, false))
+            return LLIST_BUDGET_ERR;
+        lnode_t *copy = lnode_new(dst, lnode_data(n), n->size, false);
+        if (copy == NULL)
+            return LLIST_ALLOC_ERR;
+        copy->prev = dst->tail;
+        if (dst->tail != NULL)
+            dst->tail->next = copy;
+        else
+            dst->head = copy;
+        dst->tail = copy;
+        dst->len++;
+    }
+    return LLIST_OK;
+}
+
+// Frees the element inside the given linked list node and gives the node 
+// back to the pool. The node must not be used afterwards. 
+//
+// PARAMS: 
+// l - the linked list owning the node
 // n - the node to free
-static void lnode_free_whole(lnode_t *n) {
+static void lnode_free_whole(llist_t *l, lnode_t *n) {
     if (n != NULL) {
-        free(n->data);
-        n->prev = NULL;     // incase access after free
-        n->next = NULL;
-        n->data = NULL;
-        free(n);
+        LLIST_STAT(l, free_bytes += lnode_span(l, n->size, n->slotted));
+        mem_release(l, lnode_cost(l, n->size, n->slotted));
+        l->bytes -= n->size;
+        if (n->size > LLIST_INLINE_MAX)
+            free(n->u.ptr);
+        pool_put(l, n);
     }
 }
 
-// Frees the given linked list node and return the internal element. 
+// Unlinks the given linked list node and returns the internal element. Arena 
+// nodes are only detached, as their memory belongs to the arena. Heap nodes 
+// go back to the pool, so an element stored in its node is first copied to a 
+// block of its own, which the caller frees as usual. 
 //
 // PARAMS: 
+// l - the linked list owning the node
 // n - the node to free
-static void *lnode_free(lnode_t *n) {
-    void *ret = NULL;
-    if (n != NULL) {
-        ret = n->data;
-        n->prev = NULL;     // incase access after free
-        n->next = NULL;
-        n->data = NULL;
-        free(n);
+//
+// RET: 
+// The element of the node, or NULL if any error occurred, in which case the 
+// node stays in the list. 
+static void *lnode_free(llist_t *l, lnode_t *n) {
+    if (n == NULL)
+        return NULL;
+
+    void *ret = lnode_data(n);
+    if (l->chunk == 0 && n->size <= LLIST_INLINE_MAX) {
+        ret = malloc(n->size);
+        if (ret == NULL)
+            return NULL;
+        memcpy(ret, lnode_data(n), n->size);
+    }
+    llist_unlink(l, n);
+    slot_release(l, n);     // stales every handle to the node
+    l->bytes -= n->size;
+    if (l->chunk == 0) {
+        LLIST_STAT(l, free_bytes += lnode_span(l, n->size, n->slotted));
+        mem_release(l, lnode_cost(l, n->size, n->slotted));
+        pool_put(l, n);
     }
     return ret;
 }
-
@@ -10,27 +10,179 @@
 #define LLIST_H
 #include <stdlib.h>
 #include <stdbool.h>
+#include <stdint.h>
 #include <string.h>
 
 #define LLIST_OK 0
 #define LLIST_NULL_ERR 1
 #define LLIST_ALLOC_ERR 2
+#define LLIST_IO_ERR 3
+#define LLIST_BUDGET_ERR 4
+#define LLIST_FULL_ERR 5
+#define LLIST_HANDLE_ERR 6
+#define LLIST_MODE_ERR 7
 
-// The linked list node type. 
+#define LLIST_CODEC_NONE 0                  // stream blocks stored raw
+#define LLIST_CODEC_LZ 1                    // stream blocks LZ compressed
+
+#define LLIST_TRACE_ENTER 0                 // trace event on function entry
+#define LLIST_TRACE_EXIT 1                  // trace event on function exit
+
+#define LLIST_OP_INIT 0                     // traced functions
+#define LLIST_OP_GET 1
+#define LLIST_OP_ADD 2
+#define LLIST_OP_INS 3
+#define LLIST_OP_DEL 4
+#define LLIST_OP_CLEAR 5
+#define LLIST_OP_SAVE 6
+#define LLIST_OP_LOAD 7
+#define LLIST_OP_EXPORT 8
+#define LLIST_OP_IMPORT 9
+#define LLIST_OP_REVERSE 10
+#define LLIST_OP_ROTATE 11
+#define LLIST_OP_SPLIT 12
+#define LLIST_OP_CLONE 13
+#define LLIST_OP_MOVE 14
+#define LLIST_OP_FREEZE 15
+#define LLIST_OP_THAW 16
+#define LLIST_OP_FOR_EACH 17
+#define LLIST_OP_REDUCE 18
+
+#define LLIST_TINY_MAX 4                    // largest element in a tiny node
+#define LLIST_INLINE_MAX 16                 // largest element stored in node
+#define LLIST_ELEM_MAX 0x7fffffffu          // largest element size
+#define LLIST_ARENA_CHUNK 65536             // default arena chunk size
+#define LLIST_ARENA_ALIGN 16                // arena allocation alignment
+#define LLIST_STREAM_BLOCK 65536            // raw bytes per stream block
+#define LLIST_STATS_BUCKETS 64              // index histogram buckets
+
+// The linked list node type. A node is only as long as its element needs: 
+// elements up to LLIST_TINY_MAX bytes end the node in t.buf, larger ones up 
+// to LLIST_INLINE_MAX bytes end it in u.buf, and the rest are reached through 
+// u.ptr. A 4 byte element so costs a 24 byte node. Nodes must never be copied 
+// by value. A node made for a handle keeps its slot in whichever of t and u 
+// the element leaves free, which adds 8 bytes to a tiny node. 
 typedef struct linked_list_node_t {
-    void *data;                             // internal data
     struct linked_list_node_t *prev;        // pointer to previous
     struct linked_list_node_t *next;        // pointer to next
+    uint32_t size : 31;                     // size of internal data
+    uint32_t slotted : 1;                   // has room for a handle slot
+    union {
+        unsigned char buf[LLIST_TINY_MAX];  // element, if tiny
+        uint32_t slot;                      // handle slot, if not tiny
+    } t;
+    union {
+        unsigned char buf[LLIST_INLINE_MAX];    // element, if inline
+        void *ptr;                          // element, if not inline
+        uint32_t slot;                      // handle slot, if tiny
+    } u;
 } lnode_t;
 
+// The linked list handle type, naming one node for as long as it stays in 
+// its list, however the elements around it move. A handle indexes a slot 
+// table owned by the list, so a stale handle is caught from the table alone, 
+// without reading the node it named. 
+typedef struct linked_list_handle_t {
+    uint32_t slot;                          // slot in the list, 0 if none
+    uint32_t gen;                           // generation of the slot
+} llist_handle_t;
+
+// The arena chunk type, used by arena-backed linked lists. 
+typedef struct linked_list_chunk_t {
+    struct linked_list_chunk_t *next;       // previously filled chunk
+    size_t used;                            // bytes used in this chunk
+    size_t cap;                             // bytes available in this chunk
+} lchunk_t;
+
+// The linked list statistics type. Only collected when the library and its 
+// users are compiled with LLIST_STATS defined. Bucket 0 of the histogram 
+// counts accesses to index 0, and bucket k counts indices in [2^(k-1), 2^k). 
+typedef struct linked_list_stats_t {
+    size_t adds;                            // llist_add calls
+    size_t inss;                            // llist_ins calls
+    size_t dels;                            // llist_del calls
+    size_t gets;                            // llist_get calls
+    size_t lookups;                         // index lookups
+    size_t hops;                            // pointer hops over all lookups
+    size_t max_hops;                        // pointer hops of worst lookup
+    size_t alloc_bytes;                     // bytes allocated
+    size_t free_bytes;                      // bytes freed or handed back
+    size_t hist[LLIST_STATS_BUCKETS];       // lookups by index
+} llist_stats_t;
+
 // The linked list type. 
 typedef struct linked_list_t {
     lnode_t *head;                          // list head
     lnode_t *tail;                          // list tail
     size_t len;                             // list size
+    lchunk_t *arena;                        // arena chunks, newest first
+    struct linked_list_pool_t *pool;        // node pool, NULL if none
+    size_t chunk;                           // arena chunk size, 0 if no arena
+    size_t bytes;                           // payload bytes of the elements
+    size_t heap;                            // estimated bytes from malloc
+    bool metered;                           // charged to the global budget
+    lnode_t **index;                        // every node while frozen
+    struct linked_list_slot_t *slots;       // handle slots, NULL if none
+    uint32_t cap;                           // slots allocated
+    uint32_t top;                           // slots ever handed out
+    uint32_t free;                          // first free slot, 0 if none
+    uint32_t gen;                           // last slot generation
+#ifdef LLIST_STATS
+    llist_stats_t stats;                    // operation counters
+#endif
 } llist_t;
 
-// Initialises the specified linked list. 
+// The linked list memory footprint type. The overhead is an estimate of the 
+// malloc headers and rounding, plus unused and unlinked arena space and the 
+// handle slot table. Pooled nodes free for reuse are not counted. 
+typedef struct linked_list_memory_t {
+    size_t nodes;                           // bytes of node links and sizes
+    size_t payload;                         // bytes of elements
+    size_t overhead;                        // estimated allocator slack
+} llist_memory_t;
+
+// The linked list trace event type, passed to the trace hook. 
+typedef struct linked_list_trace_t {
+    int op;                                 // LLIST_OP_* of the function
+    int phase;                              // entry or exit
+    const llist_t *l;                       // list operated on
+    size_t index;                           // index, SIZE_MAX if unknown
+    size_t len;                             // list size at the event
+    size_t hops;                            // lookup pointer hops, on exit
+    uint64_t alloc_ns;                      // allocator time, on exit
+} llist_trace_t;
+
+// The trace hook type. 
+typedef void (*llist_trace_fn)(const llist_trace_t *ev, void *ctx);
+
+#ifdef LLIST_TRACE
+void llist_trace_emit(int op, int phase, const llist_t *l, size_t i, 
+        size_t hops, uint64_t ns);
+uint64_t llist_trace_now(void);
+#define LLIST_TRACE_EVENT(op, ph, l, i, hops, ns) \
+    llist_trace_emit((op), (ph), (l), (i), (hops), (ns))
+#define LLIST_TRACE_CLOCK(t) uint64_t t = llist_trace_now()
+#else
+#define LLIST_TRACE_EVENT(op, ph, l, i, hops, ns) ((void)0)
+#define LLIST_TRACE_CLOCK(t) ((void)0)
+#endif
+
+// Returns the element stored in the given node, inline or not. 
+//
+// PARAMS: 
+// n - the node holding the element
+//
+// RET: 
+// The element of the node. 
+static inline void *lnode_data(const lnode_t *n) {
+    if (n->size <= LLIST_TINY_MAX)
+        return (void *)n->t.buf;
+    return (n->size <= LLIST_INLINE_MAX) ? (void *)n->u.buf : n->u.ptr;
+}
+
+// Initialises the specified linked list. Nodes are carved from slabs of a 
+// node pool owned by the list, and the nodes of deleted elements are reused 
+// by later adds until the list is cleared. 
 //
 // PARAMS: 
 // l - the linked list to initialise
@@ -39,6 +191,19 @@ typedef struct linked_list_t {
 // Zero on success, non-zero on error. 
 int llist_init(llist_t *l);
 
+// Initialises the specified linked list in arena mode. Nodes and elements are 
+// bump allocated from chunks attached to the list. Elements can not be freed 
+// individually: llist_del only unlinks them, and llist_clear releases every 
+// chunk at once. 
+//
+// PARAMS: 
+// l     - the linked list to initialise
+// chunk - the size of each arena chunk, or 0 for LLIST_ARENA_CHUNK
+//
+// RET: 
+// Zero on success, non-zero on error. 
+int llist_init_arena(llist_t *l, size_t chunk);
+
 // Returns the element at the given index in the specified linked list. If the 
 // index is out of range, then the last element will be returned. 
 //
@@ -56,19 +221,32 @@ void *llist_get(const llist_t *l, size_t i);
 // PARAMS: 
 // l - the linked list to have the element added
 // d - the element to add
-// n - the size of the element
+// n - the size of the element, at most LLIST_ELEM_MAX
 //
 // RET: 
 // Zero on success, non-zero on error. 
 int llist_add(llist_t *l, const void *d, size_t n);
 
+// Adds a new element of the given size into the given linked list without 
+// copying anything into it, and returns where the element is stored, for the 
+// caller to fill before the list is used again. 
+//
+// PARAMS: 
+// l   - the linked list to have the element added
+// n   - the size of the element, at most LLIST_ELEM_MAX
+// out - where to store the element
+//
+// RET: 
+// Zero on success, non-zero on error. 
+int llist_add_uninit(llist_t *l, size_t n, void **out);
+
 // Inserts a new element into the given linked list. The element will be 
 // stored as a copy. 
 //
 // PARAMS: 
 // l - the linked list to have the element inserted
 // d - the element to insert
-// n - the size of the element
+// n - the size of the element, at most LLIST_ELEM_MAX
 // i - the index in the linked list to insert to
 //
 // RET: 
@@ -76,21 +254,337 @@ int llist_add(llist_t *l, const void *d, size_t n);
 int llist_ins(llist_t *l, const void *d, size_t n, size_t i);
 
 // Deletes the element at the given index in the specified linked list. If the 
-// given index is out of range, then the last element will be deleted. 
+// given index is out of range, then the last element will be deleted. The 
+// returned element should be freed by the caller, unless the list is in arena 
+// mode, where it stays valid until the list is cleared. Elements stored in 
+// their node are copied out first, as the node goes back to the pool. 
 //
 // PARAMS: 
 // l - the linked list to have the element deleted
 // i - the index of the element
 //
 // RET: 
-// The element that just got removed. 
+// The element that just got removed, or NULL if any error occurred, in which 
+// case the element stays in the list. 
 void *llist_del(llist_t *l, size_t i);
 
-// Clears the given linked list, removing and freeing every element. 
+// Clears the given linked list, removing and freeing every element. Arena 
+// lists release their chunks instead, without visiting each element. 
 //
 // PARAMS: 
 // l - the linked list to free
 void llist_clear(llist_t *l);
 
+// Add a new element into the given linked list, like llist_add, and returns 
+// a handle to its node. The first handle allocates the slot table of the 
+// list, which grows as more handles are live at once. 
+//
+// PARAMS: 
+// l   - the linked list to have the element added
+// d   - the element to add
+// n   - the size of the element
+// out - where to store the handle
+//
+// RET: 
+// Zero on success, non-zero on error. 
+int llist_add_handle(llist_t *l, const void *d, size_t n, 
+        llist_handle_t *out);
+
+// Inserts a new element into the given linked list, like llist_ins, and 
+// returns a handle to its node, taking a slot as llist_add_handle does. 
+//
+// PARAMS: 
+// l   - the linked list to have the element inserted
+// d   - the element to insert
+// n   - the size of the element
+// i   - the index in the linked list to insert to
+// out - where to store the handle
+//
+// RET: 
+// Zero on success, non-zero on error. 
+int llist_ins_handle(llist_t *l, const void *d, size_t n, size_t i, 
+        llist_handle_t *out);
+
+// Returns the element named by the given handle in O(1). The handle must 
+// come from this list. Handles to elements deleted, split off or cleared are 
+// rejected. 
+//
+// PARAMS: 
+// l - the linked list holding the element
+// h - the handle of the element
+//
+// RET: 
+// The element of the handle, or NULL if any error occurred. 
+void *llist_get_handle(const llist_t *l, llist_handle_t h);
+
+// Deletes the element named by the given handle in O(1), like llist_del. The 
+// handle must come from this list, and is stale afterwards. Stale handles 
+// are rejected. 
+//
+// PARAMS: 
+// l - the linked list to have the element deleted
+// h - the handle of the element
+//
+// RET: 
+// The element that just got removed, or NULL if any error occurred. 
+void *llist_del_handle(llist_t *l, llist_handle_t h);
+
+// Moves the element named by a handle in front of another in O(1). No 
+// element is copied, and both handles stay valid. Both handles must come 
+// from this list. Stale handles are rejected. 
+//
+// PARAMS: 
+// l   - the linked list holding the elements
+// h   - the handle of the element to move
+// pos - the handle to move in front of, or one with slot 0 for the tail
+//
+// RET: 
+// Zero on success, LLIST_HANDLE_ERR if a handle is stale, other non-zero on 
+// error. 
+int llist_move_before(llist_t *l, llist_handle_t h, llist_handle_t pos);
+
+// Reverses the given linked list in place by swapping the links of every 
+// node. No element is copied. 
+//
+// PARAMS: 
+// l - the linked list to reverse
+//
+// RET: 
+// Zero on success, non-zero on error. 
+int llist_reverse(llist_t *l);
+
+// Rotates the given linked list left, so that the element at index k becomes 
+// the head. Only the new head is looked up, then the ends are relinked. 
+//
+// PARAMS: 
+// l - the linked list to rotate
+// k - the number of places to rotate, taken modulo the list size
+//
+// RET: 
+// Zero on success, non-zero on error. 
+int llist_rotate(llist_t *l, size_t k);
+
+// Splits the given linked list at an index, moving every element from that 
+// index on into another list, which is initialised first. No element is 
+// copied. Handles to the moved elements go stale, so if the list has a slot 
+// table the moved elements are walked to release their slots. Both lists 
+// share the node pool afterwards, so they must not be mutated concurrently. 
+// Arena lists can not be split, as their elements share chunks. 
+//
+// PARAMS: 
+// l   - the linked list to split
+// i   - the index of the first element to move
+// out - the linked list receiving the elements
+//
+// RET: 
+// Zero on success, LLIST_MODE_ERR if the list is an arena list, other 
+// non-zero on error. 
+int llist_split(llist_t *l, size_t i, llist_t *out);
+
+// Initialises a linked list as a deep copy of another, in the same mode. A 
+// heap list is copied node by node in one pass, so its elements are owned as 
+// usual. An arena list is copied as by llist_clone_arena. 
+//
+// PARAMS: 
+// dst - the linked list to initialise as the copy
+// src - the linked list to copy
+//
+// RET: 
+// Zero on success, non-zero on error. 
+int llist_clone(llist_t *dst, const llist_t *src);
+
+// Initialises a linked list as a deep copy of another. The copy is an arena 
+// list whose nodes and elements are laid out in order in one chunk, sized from 
+// the totals of the source, so it is built in one pass and one allocation. 
+// Like any arena list, its elements are only freed when it is cleared. 
+//
+// PARAMS: 
+// dst - the linked list to initialise as the copy
+// src - the linked list to copy
+//
+// RET: 
+// Zero on success, non-zero on error. 
+int llist_clone_arena(llist_t *dst, const llist_t *src);
+
+// Freezes the given linked list, indexing every node in one pass so that 
+// lookups by index take O(1) time. The next change to the list drops the 
+// index. Freezing an already frozen list does nothing. 
+//
+// PARAMS: 
+// l - the linked list to freeze
+//
+// RET: 
+// Zero on success, non-zero on error. 
+int llist_freeze(llist_t *l);
+
+// Drops the index of the given linked list, if it is frozen. 
+//
+// PARAMS: 
+// l - the linked list to thaw
+void llist_thaw(llist_t *l);
+
+// Copies the operation counters of the given linked list. Without 
+// LLIST_STATS, every counter reads as zero. 
+//
+// PARAMS: 
+// l   - the linked list to read the counters of
+// out - where to store the counters
+//
+// RET: 
+// Zero on success, non-zero on error. 
+int llist_stats(const llist_t *l, llist_stats_t *out);
+
+// Resets the operation counters of the given linked list to zero. 
+//
+// PARAMS: 
+// l - the linked list to reset the counters of
+void llist_stats_reset(llist_t *l);
+
+// Returns the memory footprint of the given linked list in O(1), from totals 
+// kept up to date by every add and delete. 
+//
+// PARAMS: 
+// l   - the linked list to measure
+// out - where to store the footprint
+//
+// RET: 
+// Zero on success, non-zero on error. 
+int llist_memory_usage(const llist_t *l, llist_memory_t *out);
+
+// Sets a memory budget shared by every linked list initialised afterwards. 
+// Adding or inserting an element fails with LLIST_BUDGET_ERR when its 
+// estimated footprint would push the total over the budget. The total is not 
+// synchronised, so metered lists must not be mutated concurrently. 
+//
+// PARAMS: 
+// bytes - the budget in bytes, or 0 to disable it
+void llist_set_budget(size_t bytes);
+
+// Returns the estimated bytes held by every linked list charged to the 
+// budget. 
+//
+// RET: 
+// The bytes charged to the budget. 
+size_t llist_budget_used(void);
+
+// Sets the hook called on entry and exit of the public llist_* functions. 
+// Events are only emitted when the library is compiled with LLIST_TRACE, 
+// otherwise the probes compile away. The hook should be set before lists are 
+// used from several threads. 
+//
+// PARAMS: 
+// fn  - the hook to call, or NULL to disable tracing
+// ctx - the context passed to fn
+void llist_set_trace(llist_trace_fn fn, void *ctx);
+
+// Writes the given linked list to a file descriptor, as a magic number and 
+// element count followed by every element prefixed with its size. 
+//
+// PARAMS: 
+// l  - the linked list to write
+// fd - the file descriptor to write to
+//
+// RET: 
+// Zero on success, non-zero on error. 
+int llist_save(const llist_t *l, int fd);
+
+// Reads a linked list written by llist_save from a file descriptor, adding 
+// every element read to the end of the given linked list. On error, the 
+// elements read so far stay in the list. Arena lists take their nodes from 
+// chunks in bulk, and heap lists from their node pool. Elements too large 
+// for the read buffer are read straight into their node. 
+//
+// PARAMS: 
+// l  - the linked list to have the elements added
+// fd - the file descriptor to read from
+//
+// RET: 
+// Zero on success, non-zero on error. 
+int llist_load(llist_t *l, int fd);
+
+// The stream writer callback type, called with each encoded chunk. Returns 
+// zero on success, non-zero to abort the export. 
+typedef int (*llist_writer_fn)(void *ctx, const void *buf, size_t n);
+
+// The stream reader callback type, filling buf with up to n bytes. Returns 
+// the number of bytes read, or zero at the end of the stream or on error. 
+typedef size_t (*llist_reader_fn)(void *ctx, void *buf, size_t n);
+
+// Exports the given linked list as a stream of framed blocks in one pass. 
+// Elements are packed into blocks of LLIST_STREAM_BLOCK bytes, and each block 
+// is compressed with the given codec when that makes it smaller. 
+//
+// PARAMS: 
+// l     - the linked list to export
+// w     - the callback receiving the encoded stream
+// ctx   - the context passed to w
+// codec - LLIST_CODEC_NONE or LLIST_CODEC_LZ
+//
+// RET: 
+// Zero on success, non-zero on error. 
+int llist_export_stream(const llist_t *l, llist_writer_fn w, void *ctx, 
+        int codec);
+
+// Imports a stream written by llist_export_stream block by block, adding 
+// every element to the end of the given linked list. Memory use is bounded by 
+// two blocks plus the largest element. On error, the elements read so far 
+// stay in the list. 
+//
+// PARAMS: 
+// l   - the linked list to have the elements added
+// r   - the callback providing the encoded stream
+// ctx - the context passed to r
+//
+// RET: 
+// Zero on success, non-zero on error. 
+int llist_import_stream(llist_t *l, llist_reader_fn r, void *ctx);
+
+// The parallel element callback type, called with each element, its size and 
+// the caller context. 
+typedef void (*llist_apply_fn)(void *d, size_t n, void *ctx);
+
+// The parallel reduction type. Each chunk of the list is folded into its own 
+// accumulator, starting from a copy of identity, and the chunk results are 
+// then combined from head to tail. Chunk boundaries only depend on the list 
+// size, so the result does not depend on the number of threads. 
+typedef struct linked_list_reducer_t {
+    void (*map)(void *acc, const void *d, size_t n, void *ctx);
+    void (*combine)(void *acc, const void *rhs, void *ctx);
+    const void *identity;                   // initial accumulator value
+    size_t size;                            // size of an accumulator
+    void *ctx;                              // context passed to map, combine
+} llist_reducer_t;
+
+// Calls the given function on every element of the specified linked list, 
+// using the given number of threads. The list is split into chunks in one 
+// pass, and chunks are striped across the threads. The function must be safe 
+// to call concurrently on different elements. 
+//
+// PARAMS: 
+// l        - the linked list to traverse
+// fn       - the function to call with each element
+// ctx      - the context passed to fn
+// nthreads - the number of threads, or 0 for one per online CPU
+//
+// RET: 
+// Zero on success, non-zero on error. 
+int llist_parallel_for_each(llist_t *l, llist_apply_fn fn, void *ctx, 
+        size_t nthreads);
+
+// Reduces every element of the specified linked list into out, using the 
+// given number of threads. The map and combine functions must be safe to call 
+// concurrently on different accumulators. 
+//
+// PARAMS: 
+// l        - the linked list to reduce
+// r        - the reduction to run
+// out      - where to store the result, r->size bytes
+// nthreads - the number of threads, or 0 for one per online CPU
+//
+// RET: 
+// Zero on success, non-zero on error. 
+int llist_parallel_reduce(const llist_t *l, const llist_reducer_t *r, 
+        void *out, size_t nthreads);
+
 #endif
 
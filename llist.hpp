@@ -0,0 +1,311 @@
+///////////////////////////////////////////////////////////////////////////////
+// llist.hpp
+// Header-only linked list template in C++17.
+//
+// ll::llist<T, Alloc> uses the same node design as llist_t (prev and next
+// links with the element stored inline), but constructs elements in place
+// through the allocator instead of copying bytes, so move-only and
+// non-trivially-copyable types are supported. ll::pmr::llist<T> uses a
+// std::pmr::polymorphic_allocator.
+//
+// Author: agent
+// Date:   17/10/2026
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef LLIST_HPP
+#define LLIST_HPP
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <memory_resource>
+#include <type_traits>
+#include <utility>
+
+namespace ll {
+
+// The linked list link type, shared by nodes and the list sentinel.
+struct lnode_base {
+    lnode_base *prev;                       // pointer to previous
+    lnode_base *next;                       // pointer to next
+};
+
+// The linked list node type.
+template <class T>
+struct lnode : lnode_base {
+    T data;                                 // internal data
+};
+
+// The linked list type. The list is circular through a sentinel link, which
+// acts as the end() position.
+template <class T, class Alloc = std::allocator<T>>
+class llist {
+    using node_type = lnode<T>;
+    using node_alloc = typename std::allocator_traits<Alloc>::template
+        rebind_alloc<node_type>;
+    using node_traits = std::allocator_traits<node_alloc>;
+
+    // The bidirectional iterator type over list elements.
+    template <bool Const>
+    class iter {
+        friend class llist;
+        template <bool> friend class iter;
+        lnode_base *node_ = nullptr;        // current node
+
+        explicit iter(const lnode_base *n) :
+            node_(const_cast<lnode_base *>(n)) {}
+
+    public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = std::conditional_t<Const, const T *, T *>;
+        using reference = std::conditional_t<Const, const T &, T &>;
+
+        iter() = default;
+        template <bool C = Const, class = std::enable_if_t<C>>
+        iter(const iter<false> &other) : node_(other.node_) {}
+
+        reference operator*() const {
+            return static_cast<node_type *>(node_)->data;
+        }
+        pointer operator->() const { return &**this; }
+
+        iter &operator++() { node_ = node_->next; return *this; }
+        iter operator++(int) { iter ret = *this; ++*this; return ret; }
+        iter &operator--() { node_ = node_->prev; return *this; }
+        iter operator--(int) { iter ret = *this; --*this; return ret; }
+
+        friend bool operator==(const iter &a, const iter &b) {
+            return a.node_ == b.node_;
+        }
+        friend bool operator!=(const iter &a, const iter &b) {
+            return a.node_ != b.node_;
+        }
+    };
+
+public:
+    using value_type = T;
+    using allocator_type = Alloc;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = T &;
+    using const_reference = const T &;
+    using iterator = iter<false>;
+    using const_iterator = iter<true>;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+    llist() : llist(Alloc()) {}
+    explicit llist(const Alloc &a) : alloc_(a) {}
+
+    llist(const llist &other) :
+        llist(other, std::allocator_traits<Alloc>::
+            select_on_container_copy_construction(other.get_allocator())) {}
+
+    // Copies every element of the given list, using the given allocator. If
+    // a copy throws, the elements copied so far are destroyed first.
+    llist(const llist &other, const Alloc &a) : alloc_(a) {
+        try {
+            for (const T &d : other)
+                emplace_back(d);
+        } catch (...) {
+            clear();
+            throw;
+        }
+    }
+
+    llist(llist &&other) noexcept : alloc_(std::move(other.alloc_)) {
+        steal(other);
+    }
+
+    ~llist() { clear(); }
+
+    // Copies are built aside first, so the list is unchanged if one throws.
+    llist &operator=(const llist &other) {
+        constexpr bool pocca =
+            node_traits::propagate_on_container_copy_assignment::value;
+        if (this != &other) {
+            llist copy(other, pocca ? other.get_allocator() : get_allocator());
+            clear();
+            if constexpr (pocca)
+                alloc_ = other.alloc_;
+            steal(copy);
+        }
+        return *this;
+    }
+
+    llist &operator=(llist &&other) noexcept(
+        node_traits::propagate_on_container_move_assignment::value ||
+        node_traits::is_always_equal::value) {
+        if (this == &other)
+            return *this;
+        clear();
+        if constexpr (node_traits::propagate_on_container_move_assignment::
+            value) {
+            alloc_ = std::move(other.alloc_);
+            steal(other);
+        } else if (alloc_ == other.alloc_) {
+            steal(other);
+        } else {                            // different memory resource
+            for (T &d : other)
+                emplace_back(std::move(d));
+            other.clear();
+        }
+        return *this;
+    }
+
+    allocator_type get_allocator() const { return allocator_type(alloc_); }
+
+    iterator begin() noexcept { return iterator(head_.next); }
+    const_iterator begin() const noexcept { return const_iterator(head_.next); }
+    const_iterator cbegin() const noexcept { return begin(); }
+    iterator end() noexcept { return iterator(&head_); }
+    const_iterator end() const noexcept { return const_iterator(&head_); }
+    const_iterator cend() const noexcept { return end(); }
+    reverse_iterator rbegin() noexcept { return reverse_iterator(end()); }
+    const_reverse_iterator rbegin() const noexcept {
+        return const_reverse_iterator(end());
+    }
+    reverse_iterator rend() noexcept { return reverse_iterator(begin()); }
+    const_reverse_iterator rend() const noexcept {
+        return const_reverse_iterator(begin());
+    }
+
+    bool empty() const noexcept { return len_ == 0; }
+    size_type size() const noexcept { return len_; }
+
+    reference front() { return *begin(); }
+    const_reference front() const { return *begin(); }
+    reference back() { return *--end(); }
+    const_reference back() const { return *--end(); }
+
+    // Constructs a new element in place before the given position.
+    template <class... Args>
+    iterator emplace(const_iterator pos, Args &&...args) {
+        node_type *n = node_traits::allocate(alloc_, 1);
+        try {
+            node_traits::construct(alloc_, std::addressof(n->data),
+                std::forward<Args>(args)...);
+        } catch (...) {
+            node_traits::deallocate(alloc_, n, 1);
+            throw;
+        }
+        lnode_base *aft = pos.node_;
+        n->next = aft;
+        n->prev = aft->prev;
+        aft->prev->next = n;
+        aft->prev = n;
+        len_++;
+        return iterator(n);
+    }
+
+    template <class... Args>
+    reference emplace_back(Args &&...args) {
+        return *emplace(end(), std::forward<Args>(args)...);
+    }
+
+    template <class... Args>
+    reference emplace_front(Args &&...args) {
+        return *emplace(begin(), std::forward<Args>(args)...);
+    }
+
+    iterator insert(const_iterator pos, const T &d) { return emplace(pos, d); }
+    iterator insert(const_iterator pos, T &&d) {
+        return emplace(pos, std::move(d));
+    }
+    void push_back(const T &d) { emplace_back(d); }
+    void push_back(T &&d) { emplace_back(std::move(d)); }
+    void push_front(const T &d) { emplace_front(d); }
+    void push_front(T &&d) { emplace_front(std::move(d)); }
+
+    // Destroys the element at the given position, returning the next one.
+    iterator erase(const_iterator pos) {
+        lnode_base *n = pos.node_;
+        lnode_base *next = n->next;
+        n->prev->next = next;
+        next->prev = n->prev;
+        len_--;
+        destroy(static_cast<node_type *>(n));
+        return iterator(next);
+    }
+
+    iterator erase(const_iterator first, const_iterator last) {
+        while (first != last)
+            first = erase(first);
+        return iterator(last.node_);
+    }
+
+    void pop_front() { erase(begin()); }
+    void pop_back() { erase(--end()); }
+
+    void clear() noexcept {
+        lnode_base *current = head_.next;
+        while (current != &head_) {
+            lnode_base *n = current;
+            current = current->next;
+            destroy(static_cast<node_type *>(n));
+        }
+        head_.prev = &head_;
+        head_.next = &head_;
+        len_ = 0;
+    }
+
+    void swap(llist &other) noexcept {
+        if constexpr (node_traits::propagate_on_container_swap::value) {
+            using std::swap;
+            swap(alloc_, other.alloc_);
+        }
+        std::swap(head_, other.head_);
+        std::swap(len_, other.len_);
+        relink();
+        other.relink();
+    }
+
+private:
+    // Takes every node of the given list, leaving it empty.
+    void steal(llist &other) noexcept {
+        if (other.len_ == 0)
+            return;
+        head_.next = other.head_.next;
+        head_.prev = other.head_.prev;
+        head_.next->prev = &head_;
+        head_.prev->next = &head_;
+        len_ = other.len_;
+        other.head_.prev = &other.head_;
+        other.head_.next = &other.head_;
+        other.len_ = 0;
+    }
+
+    // Points the first and last nodes back at this list's sentinel.
+    void relink() noexcept {
+        if (len_ == 0) {
+            head_.prev = &head_;
+            head_.next = &head_;
+        } else {
+            head_.next->prev = &head_;
+            head_.prev->next = &head_;
+        }
+    }
+
+    void destroy(node_type *n) noexcept {
+        node_traits::destroy(alloc_, std::addressof(n->data));
+        node_traits::deallocate(alloc_, n, 1);
+    }
+
+    lnode_base head_{&head_, &head_};       // list sentinel
+    size_type len_ = 0;                     // list size
+    node_alloc alloc_;                      // node allocator
+};
+
+template <class T, class Alloc>
+void swap(llist<T, Alloc> &a, llist<T, Alloc> &b) noexcept { a.swap(b); }
+
+namespace pmr {
+template <class T>
+using llist = ll::llist<T, std::pmr::polymorphic_allocator<T>>;
+}
+
+}
+
+#endif
+
@@ -0,0 +1,463 @@
+///////////////////////////////////////////////////////////////////////////////
+// llist_bench.cpp
+// Linked list benchmark suite in C++17.
+//
+// Runs reproducible workloads over llist_t (heap and arena mode), sllist_t,
+// dqlist_t, ll::llist, std::list and std::vector, and prints a JSON array with one
+// object per case: ns/op, allocations/op and the peak RSS of the case. Every
+// case runs in its own forked process, so peak RSS is per case. The timers
+// workload drives twheel_t with up to max-n concurrent timers.
+//
+//     make bench
+//     ./llist_bench [--max-n N] [--filter WORKLOAD] > bench.json
+//
+// Allocation counts need glibc, and are reported as null elsewhere.
+//
+// Author: agent
+// Date:   17/10/2026
+///////////////////////////////////////////////////////////////////////////////
+
+extern "C" {
+#include "llist.h"
+#include "sllist.h"
+#include "dqlist.h"
+#include "twheel.h"
+}
+#include "llist.hpp"
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <list>
+#include <string>
+#include <vector>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+///////////////////////////////////////////////////////////////////////////////
+// Allocation counting. malloc and friends are interposed in this binary and
+// forwarded to glibc, so C and C++ allocations are both seen.
+
+static size_t g_allocs = 0;
+
+#if defined(__GLIBC__)
+#define BENCH_COUNTS_ALLOCS 1
+extern "C" {
+void *__libc_malloc(size_t n);
+void *__libc_calloc(size_t c, size_t n);
+void *__libc_realloc(void *p, size_t n);
+void __libc_free(void *p);
+
+void *malloc(size_t n) { g_allocs++; return __libc_malloc(n); }
+void *calloc(size_t c, size_t n) { g_allocs++; return __libc_calloc(c, n); }
+void *realloc(void *p, size_t n) {
+    if (p == nullptr)
+        g_allocs++;
+    return __libc_realloc(p, n);
+}
+void free(void *p) { __libc_free(p); }
+}
+#else
+#define BENCH_COUNTS_ALLOCS 0
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+// Helpers.
+
+// Reproducible xorshift64 generator.
+struct rng {
+    uint64_t s = 0x9e3779b97f4a7c15ull;
+    uint64_t next() {
+        s ^= s << 13;
+        s ^= s >> 7;
+        s ^= s << 17;
+        return s;
+    }
+    size_t below(size_t n) { return (size_t)(next() % n); }
+};
+
+template <size_t S>
+using elem = std::array<unsigned char, S>;
+
+template <size_t S>
+static elem<S> make_elem(size_t i) {
+    elem<S> e{};
+    e[0] = (unsigned char)i;
+    e[S - 1] = (unsigned char)(i >> 8);
+    return e;
+}
+
+static volatile size_t g_sink = 0;          // defeats dead code elimination
+
+///////////////////////////////////////////////////////////////////////////////
+// Adapters giving every implementation the same interface. Capabilities an
+// implementation lacks are marked false and its cases are skipped.
+
+template <size_t S>
+struct c_llist {
+    static constexpr bool random = true, shuffles = true, fifo = true;
+    llist_t l;
+    explicit c_llist(bool arena = false) {
+        if (arena)
+            llist_init_arena(&l, 0);
+        else
+            llist_init(&l);
+    }
+    ~c_llist() { llist_clear(&l); }
+    void append(const elem<S> &e) { llist_add(&l, e.data(), S); }
+    size_t get(size_t i) { return *(unsigned char *)llist_get(&l, i); }
+    void ins(size_t i, const elem<S> &e) { llist_ins(&l, e.data(), S, i); }
+    void del(size_t i) {
+        void *d = llist_del(&l, i);
+        if (l.chunk == 0)
+            std::free(d);
+    }
+    size_t scan() {
+        size_t sum = 0;
+        for (lnode_t *n = l.head; n != nullptr; n = n->next)
+            sum += *(unsigned char *)lnode_data(n);
+        return sum;
+    }
+    void clear() { llist_clear(&l); }
+    void shuffle(rng &r) {                  // relink nodes in random order
+        std::vector<lnode_t *> nodes;
+        for (lnode_t *n = l.head; n != nullptr; n = n->next)
+            nodes.push_back(n);
+        for (size_t i = nodes.size(); i > 1; i--)
+            std::swap(nodes[i - 1], nodes[r.below(i)]);
+        for (size_t i = 0; i < nodes.size(); i++) {
+            nodes[i]->prev = (i == 0) ? nullptr : nodes[i - 1];
+            nodes[i]->next = (i + 1 == nodes.size()) ? nullptr : nodes[i + 1];
+        }
+        l.head = nodes.empty() ? nullptr : nodes.front();
+        l.tail = nodes.empty() ? nullptr : nodes.back();
+    }
+};
+
+template <size_t S>
+struct c_llist_arena : c_llist<S> {
+    c_llist_arena() : c_llist<S>(true) {}
+};
+
+template <size_t S>
+struct c_sllist {
+    static constexpr bool random = false, shuffles = false, fifo = true;
+    sllist_t l;
+    c_sllist() { sllist_init(&l); }
+    ~c_sllist() { sllist_clear(&l); }
+    void append(const elem<S> &e) { sllist_add(&l, e.data(), S); }
+    size_t get(size_t) { return 0; }
+    void ins(size_t, const elem<S> &) {}
+    void del(size_t) { std::free(sllist_pop(&l)); }     // fifo pops the head
+    size_t scan() {
+        size_t sum = 0;
+        for (slnode_t *n = l.head; n != nullptr; n = n->next)
+            sum += n->data[0];
+        return sum;
+    }
+    void clear() { sllist_clear(&l); }
+    void shuffle(rng &) {}
+};
+
+template <size_t S>
+struct c_dqlist {
+    static constexpr bool random = true, shuffles = false, fifo = true;
+    dqlist_t l;
+    c_dqlist() { dqlist_init(&l, S, 0); }
+    ~c_dqlist() { dqlist_clear(&l); }
+    void append(const elem<S> &e) { dqlist_add(&l, e.data()); }
+    size_t get(size_t i) { return *(unsigned char *)dqlist_get(&l, i); }
+    void ins(size_t i, const elem<S> &e) { dqlist_ins(&l, e.data(), i); }
+    void del(size_t i) { dqlist_del(&l, i, nullptr); }
+    size_t scan() {
+        size_t sum = 0;
+        for (size_t i = 0; i < l.len; i++)
+            sum += *(unsigned char *)dqlist_get(&l, i);
+        return sum;
+    }
+    void clear() { dqlist_clear(&l); }
+    void shuffle(rng &) {}
+};
+
+// Walks a bidirectional container from its nearer end, like lnode_get.
+template <class C>
+static typename C::iterator walk(C &c, size_t i) {
+    if (i >= c.size() / 2) {
+        auto it = c.end();
+        std::advance(it, -(std::ptrdiff_t)(c.size() - i));
+        return it;
+    }
+    return std::next(c.begin(), (std::ptrdiff_t)i);
+}
+
+template <class C, size_t S, bool Shuffles>
+struct cxx_list {
+    static constexpr bool random = true, shuffles = Shuffles, fifo = true;
+    C l;
+    void append(const elem<S> &e) { l.push_back(e); }
+    size_t get(size_t i) { return (*walk(l, i))[0]; }
+    void ins(size_t i, const elem<S> &e) { l.insert(walk(l, i), e); }
+    void del(size_t i) { l.erase(walk(l, i)); }
+    size_t scan() {
+        size_t sum = 0;
+        for (const auto &e : l)
+            sum += e[0];
+        return sum;
+    }
+    void clear() { l.clear(); }
+    void shuffle(rng &r) {
+        if constexpr (Shuffles) {               // splice nodes in random order
+            C out;
+            while (!l.empty())
+                out.splice(out.end(), l, walk(l, r.below(l.size())));
+            l.swap(out);
+        }
+    }
+};
+
+template <size_t S>
+struct std_list : cxx_list<std::list<elem<S>>, S, true> {};
+
+template <size_t S>
+struct ll_list : cxx_list<ll::llist<elem<S>>, S, false> {};
+
+template <size_t S>
+struct std_vector {
+    static constexpr bool random = true, shuffles = false, fifo = false;
+    std::vector<elem<S>> v;
+    void append(const elem<S> &e) { v.push_back(e); }
+    size_t get(size_t i) { return v[i][0]; }
+    void ins(size_t i, const elem<S> &e) { v.insert(v.begin() + i, e); }
+    void del(size_t i) { v.erase(v.begin() + i); }
+    size_t scan() {
+        size_t sum = 0;
+        for (const auto &e : v)
+            sum += e[0];
+        return sum;
+    }
+    void clear() { v.clear(); v.shrink_to_fit(); }
+    void shuffle(rng &) {}
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// Workloads. Each returns the number of operations timed, and reports the
+// elapsed time and allocations of the timed part only.
+
+struct result {
+    size_t ops = 0;
+    double ns = 0;
+    size_t allocs = 0;
+};
+
+// Times the given function, counting allocations made inside it.
+template <class F>
+static result timed(size_t ops, F &&f) {
+    result r;
+    r.ops = ops;
+    size_t a = g_allocs;
+    auto t0 = std::chrono::steady_clock::now();
+    f();
+    auto t1 = std::chrono::steady_clock::now();
+    r.allocs = g_allocs - a;
+    r.ns = std::chrono::duration<double, std::nano>(t1 - t0).count();
+    return r;
+}
+
+// Random access ops for a list of n, keeping every case around a fixed
+// number of pointer hops.
+static size_t random_ops(size_t n) {
+    size_t ops = (size_t)4e8 / n;
+    return std::clamp<size_t>(ops, 16, 100000);
+}
+
+template <class L, size_t S>
+static void fill(L &l, size_t n) {
+    for (size_t i = 0; i < n; i++)
+        l.append(make_elem<S>(i));
+}
+
+template <template <size_t> class Impl, size_t S>
+static bool run(const std::string &w, size_t n, result &r) {
+    using L = Impl<S>;
+    rng g;
+    L l;
+    if (w == "append") {
+        r = timed(n, [&] { fill<L, S>(l, n); });
+    } else if (w == "scan_fresh" || w == "scan_fragmented") {
+        if (w == "scan_fragmented" && !L::shuffles)
+            return false;
+        fill<L, S>(l, n);
+        if (w == "scan_fragmented")
+            l.shuffle(g);
+        g_sink = l.scan();                  // warm up
+        r = timed(n, [&] { g_sink = l.scan(); });
+    } else if (w == "clear") {
+        fill<L, S>(l, n);
+        r = timed(n, [&] { l.clear(); });
+    } else if (w == "fifo") {               // bounded queue in steady state
+        if (!L::fifo)
+            return false;
+        fill<L, S>(l, n);
+        size_t ops = std::max<size_t>(n, 1000000);
+        r = timed(ops, [&] {
+            for (size_t k = 0; k < ops; k++) {
+                l.del(0);
+                l.append(make_elem<S>(k));
+            }
+        });
+    } else if (!L::random) {
+        return false;
+    } else if (w == "get_random") {
+        fill<L, S>(l, n);
+        size_t ops = random_ops(n);
+        r = timed(ops, [&] {
+            size_t sum = 0;
+            for (size_t k = 0; k < ops; k++)
+                sum += l.get(g.below(n));
+            g_sink = sum;
+        });
+    } else if (w == "ins_random" || w == "del_random") {
+        fill<L, S>(l, n);
+        size_t ops = std::min(random_ops(n), n / 2);
+        bool ins = (w == "ins_random");
+        r = timed(ops, [&] {
+            for (size_t k = 0; k < ops; k++) {
+                if (ins)
+                    l.ins(g.below(n + k), make_elem<S>(k));
+                else
+                    l.del(g.below(n - k));
+            }
+        });
+    } else {
+        return false;
+    }
+    return true;
+}
+
+// Keeps n timers pending in a timer wheel, with delays spread over 2^16
+// ticks so most timers start on the second level. A quarter are cancelled,
+// then the wheel is advanced until the rest have fired. Every schedule,
+// cancel and expiry counts as one op.
+static void timer_fire(ttimer_t *, void *) { g_sink = g_sink + 1; }
+
+static bool run_timers(size_t n, result &r) {
+    rng g;
+    std::vector<ttimer_t> t(n);
+    std::vector<uint64_t> delay(n);
+    twheel_t *w = new twheel_t;
+    twheel_init(w, 0);
+    for (size_t i = 0; i < n; i++) {
+        ttimer_init(&t[i], timer_fire, nullptr);
+        delay[i] = 1 + g.below(1 << 16);
+    }
+    size_t fired = 0, cancels = (n + 3) / 4;
+    r = timed(n + cancels + (n - cancels), [&] {
+        for (size_t i = 0; i < n; i++)
+            twheel_schedule(w, &t[i], delay[i]);
+        for (size_t i = 0; i < n; i += 4)
+            twheel_cancel(w, &t[i]);
+        while (w->len != 0)
+            fired += twheel_advance(w, 1024);
+    });
+    delete w;
+    return fired == n - cancels;
+}
+
+// Runs one case in a child process and prints its JSON object.
+static void fork_case(const char *impl, const std::string &w, size_t n,
+        size_t elem, bool &first, const std::function<bool(result &)> &f) {
+    std::fflush(stdout);
+    pid_t pid = fork();
+    if (pid == 0) {
+        result r;
+        if (f(r)) {
+            struct rusage ru;
+            getrusage(RUSAGE_SELF, &ru);
+            std::printf("%s  {\"workload\": \"%s\", \"impl\": \"%s\", "
+                "\"n\": %zu, \"elem_size\": %zu, \"ops\": %zu, "
+                "\"ns_per_op\": %.2f, \"allocs_per_op\": ",
+                first ? "" : ",\n", w.c_str(), impl, n, elem, r.ops,
+                r.ns / (double)r.ops);
+            if (BENCH_COUNTS_ALLOCS)
+                std::printf("%.3f", (double)r.allocs / (double)r.ops);
+            else
+                std::printf("null");
+            std::printf(", \"peak_rss_kb\": %ld}", ru.ru_maxrss);
+            std::fflush(stdout);
+            _exit(0);
+        }
+        _exit(2);                           // case not supported
+    }
+    int status = 0;
+    waitpid(pid, &status, 0);
+    if (WIFEXITED(status) && WEXITSTATUS(status) == 0)
+        first = false;
+}
+
+template <template <size_t> class Impl, size_t S>
+static void run_case(const char *impl, const std::string &w, size_t n,
+        bool &first) {
+    fork_case(impl, w, n, S, first,
+        [&](result &r) { return run<Impl, S>(w, n, r); });
+}
+
+template <size_t S>
+static void run_impls(const std::string &w, size_t n, bool &first) {
+    run_case<c_llist, S>("llist", w, n, first);
+    run_case<c_llist_arena, S>("llist_arena", w, n, first);
+    run_case<c_sllist, S>("sllist", w, n, first);
+    run_case<c_dqlist, S>("dqlist", w, n, first);
+    run_case<ll_list, S>("ll::llist", w, n, first);
+    run_case<std_list, S>("std::list", w, n, first);
+    run_case<std_vector, S>("std::vector", w, n, first);
+}
+
+int main(int argc, char **argv) {
+    size_t max_n = 10000000;
+    std::string filter;
+    for (int i = 1; i < argc; i++) {
+        if (std::strcmp(argv[i], "--max-n") == 0 && i + 1 < argc)
+            max_n = (size_t)std::strtod(argv[++i], nullptr);
+        else if (std::strcmp(argv[i], "--filter") == 0 && i + 1 < argc)
+            filter = argv[++i];
+    }
+
+    const std::vector<std::string> scaled = {"append", "get_random",
+        "ins_random", "del_random", "scan_fresh", "scan_fragmented", "clear",
+        "fifo"};
+    bool first = true;
+    std::printf("[\n");
+    for (const std::string &w : scaled) {
+        if (!filter.empty() && w.find(filter) == std::string::npos)
+            continue;
+        for (size_t n = 1000; n <= max_n; n *= 10)
+            run_impls<16>(w, n, first);
+    }
+    if (filter.empty() || std::string("timers").find(filter) !=
+        std::string::npos) {
+        for (size_t n = 1000; n <= max_n; n *= 10)
+            fork_case("twheel", "timers", n, sizeof(ttimer_t), first,
+                [n](result &r) { return run_timers(n, r); });
+    }
+
+    // element size sweep, at a fixed count
+    size_t n = std::min<size_t>(max_n, 100000);
+    for (const char *w : {"append", "scan_fresh"}) {
+        if (!filter.empty() && std::string(w).find(filter) ==
+            std::string::npos)
+            continue;
+        run_impls<4>(w, n, first);
+        run_impls<64>(w, n, first);
+        run_impls<256>(w, n, first);
+        run_impls<1024>(w, n, first);
+        run_impls<4096>(w, n, first);
+    }
+    std::printf("\n]\n");
+    return 0;
+}
+
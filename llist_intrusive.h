@@ -0,0 +1,106 @@
+///////////////////////////////////////////////////////////////////////////////
+// llist_intrusive.h
+// Intrusive linked list implementation in C99. Users embed an llist_link_t in 
+// their own structs, so linking and unlinking objects never allocates. A list 
+// is a circular chain through a sentinel link. 
+//
+//     struct job { int id; llist_link_t link; };
+//     llist_link_t jobs;
+//     llist_intrusive_init(&jobs);
+//     llist_intrusive_push_back(&jobs, &j->link);
+//     struct job *first = LLIST_CONTAINER_OF(jobs.next, struct job, link);
+//
+// Author: agent
+// Date:   17/10/2026
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef LLIST_INTRUSIVE_H
+#define LLIST_INTRUSIVE_H
+#include <stddef.h>
+#include <stdbool.h>
+
+// Returns the struct of the given type containing the given link member. 
+#define LLIST_CONTAINER_OF(ptr, type, member) \
+    ((type *)((char *)(ptr) - offsetof(type, member)))
+
+// The intrusive linked list link type. 
+typedef struct linked_list_link_t {
+    struct linked_list_link_t *prev;        // pointer to previous
+    struct linked_list_link_t *next;        // pointer to next
+} llist_link_t;
+
+// Initialises the specified intrusive linked list, or marks a link as not 
+// being in any list. 
+//
+// PARAMS: 
+// h - the sentinel link of the list
+static inline void llist_intrusive_init(llist_link_t *h) {
+    h->prev = h;
+    h->next = h;
+}
+
+// Returns whether the given intrusive linked list is empty or not. For an 
+// initialised or unlinked link, returns whether it is in no list. 
+//
+// PARAMS: 
+// h - the sentinel link of the list
+//
+// RET: 
+// True (1) if the list is empty, 0 (false) otherwise. 
+static inline bool llist_intrusive_empty(const llist_link_t *h) {
+    return h->next == h;
+}
+
+// Links the given link right after the specified position. 
+//
+// PARAMS: 
+// pos - the link to insert after, or the sentinel to insert at the head
+// n   - the link to insert
+static inline void llist_intrusive_insert_after(llist_link_t *pos,
+        llist_link_t *n) {
+    n->prev = pos;
+    n->next = pos->next;
+    pos->next->prev = n;
+    pos->next = n;
+}
+
+// Links the given link at the tail of the specified intrusive linked list. 
+//
+// PARAMS: 
+// h - the sentinel link of the list
+// n - the link to append
+static inline void llist_intrusive_push_back(llist_link_t *h,
+        llist_link_t *n) {
+    llist_intrusive_insert_after(h->prev, n);
+}
+
+// Unlinks the given link from whichever list it is in. The link is left 
+// initialised, so unlinking it again is harmless. 
+//
+// PARAMS: 
+// n - the link to unlink
+static inline void llist_intrusive_unlink(llist_link_t *n) {
+    n->prev->next = n->next;
+    n->next->prev = n->prev;
+    llist_intrusive_init(n);
+}
+
+// Calls the given function on every link of the specified intrusive linked 
+// list, from head to tail. The function may unlink the link it is given. 
+//
+// PARAMS: 
+// h   - the sentinel link of the list
+// fn  - the function to call with each link and ctx
+// ctx - the context passed to fn
+static inline void llist_intrusive_foreach(llist_link_t *h,
+        void (*fn)(llist_link_t *n, void *ctx), void *ctx) {
+    llist_link_t *current = h->next;
+    while (current != h) {
+        llist_link_t *n = current;
+        current = current->next;
+        fn(n, ctx);
+    }
+}
+
+#endif
+
@@ -0,0 +1,365 @@
+///////////////////////////////////////////////////////////////////////////////
+// llist_io.c
+// Linked list binary serialisation in C99 and POSIX. 
+//
+// The format is the magic "LLS1", the element count, then every element as 
+// its size followed by its bytes. Counts and sizes are unsigned LEB128 
+// varints, so small elements carry a single byte of framing. 
+//
+// Author: agent
+// Date:   17/10/2026
+///////////////////////////////////////////////////////////////////////////////
+
+#define _POSIX_C_SOURCE 200809L
+#include "llist.h"
+#include <errno.h>
+#include <stdint.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+#define LLIST_IO_MAGIC "LLS1"
+#define LLIST_IO_BUF 65536                  // size of staging buffers
+#define LLIST_IO_IOV 64                     // iovecs per writev call
+#define LLIST_IO_COPY 512                   // largest element staged by copy
+#define LLIST_IO_VARINT 10                  // longest varint of a uint64_t
+
+// The buffered vectored writer type. Small elements are copied into buf, 
+// while large elements are written straight from the list with their own 
+// iovec. 
+typedef struct llist_writer_t {
+    int fd;                                 // file descriptor to write
+    size_t used;                            // bytes staged in buf
+    size_t mark;                            // start of buf not yet in iov
+    int cnt;                                // iovecs queued
+    struct iovec iov[LLIST_IO_IOV];         // queued writes
+    unsigned char buf[LLIST_IO_BUF];        // staging buffer
+} lwriter_t;
+
+// The buffered reader type. 
+typedef struct llist_reader_t {
+    int fd;                                 // file descriptor to read
+    size_t pos;                             // read position in buf
+    size_t end;                             // bytes available in buf
+    unsigned char buf[LLIST_IO_BUF];        // read buffer
+} lreader_t;
+
+static void writer_seal(lwriter_t *w);
+static int writer_flush(lwriter_t *w);
+static int writer_copy(lwriter_t *w, const void *d, size_t n);
+static int writer_ref(lwriter_t *w, const void *d, size_t n);
+static int writer_varint(lwriter_t *w, uint64_t v);
+static int reader_fill(lreader_t *r);
+static int reader_read(lreader_t *r, void *d, size_t n);
+static int reader_varint(lreader_t *r, uint64_t *v);
+static void llist_load_drop(llist_t *l);
+
+// Writes the given linked list to a file descriptor, as a magic number and 
+// element count followed by every element prefixed with its size. 
+//
+// PARAMS: 
+// l  - the linked list to write
+// fd - the file descriptor to write to
+//
+// RET: 
+// Zero on success, non-zero on error. 
+int llist_save(const llist_t *l, int fd) {
+    if (l == NULL || fd < 0)
+        return LLIST_NULL_ERR;
+
+    lwriter_t *w = malloc(sizeof *w);
+    if (w == NULL)
+        return LLIST_ALLOC_ERR;
+
+    LLIST_TRACE_EVENT(LLIST_OP_SAVE, LLIST_TRACE_ENTER, l, 0, 0, 0);
+    w->fd = fd;
+    w->used = 0;
+    w->mark = 0;
+    w->cnt = 0;
+    int ret = writer_copy(w, LLIST_IO_MAGIC, 4);
+    if (ret == LLIST_OK)
+        ret = writer_varint(w, l->len);
+    for (lnode_t *n = l->head; n != NULL && ret == LLIST_OK; n = n->next) {
+        ret = writer_varint(w, n->size);
+        if (ret == LLIST_OK && n->size <= LLIST_IO_COPY)
+            ret = writer_copy(w, lnode_data(n), n->size);
+        else if (ret == LLIST_OK)
+            ret = writer_ref(w, lnode_data(n), n->size);
+    }
+    if (ret == LLIST_OK)
+        ret = writer_flush(w);
+    free(w);
+    LLIST_TRACE_EVENT(LLIST_OP_SAVE, LLIST_TRACE_EXIT, l, 0, 0, 0);
+    return ret;
+}
+
+// Reads a linked list written by llist_save from a file descriptor, adding 
+// every element read to the end of the given linked list. On error, the 
+// elements read so far stay in the list. Arena lists take their nodes from 
+// chunks in bulk, and heap lists from their node pool. Elements too large 
+// for the read buffer are read straight into their node. 
+//
+// PARAMS: 
+// l  - the linked list to have the elements added
+// fd - the file descriptor to read from
+//
+// RET: 
+// Zero on success, non-zero on error. 
+int llist_load(llist_t *l, int fd) {
+    if (l == NULL || fd < 0)
+        return LLIST_NULL_ERR;
+
+    lreader_t *r = malloc(sizeof *r);
+    if (r == NULL)
+        return LLIST_ALLOC_ERR;
+
+    LLIST_TRACE_EVENT(LLIST_OP_LOAD, LLIST_TRACE_ENTER, l, 0, 0, 0);
+    r->fd = fd;
+    r->pos = 0;
+    r->end = 0;
+    unsigned char magic[4];
+    uint64_t len = 0;
+    int ret = reader_read(r, magic, sizeof magic);
+    if (ret == LLIST_OK && memcmp(magic, LLIST_IO_MAGIC, 4) != 0)
+        ret = LLIST_IO_ERR;
+    if (ret == LLIST_OK)
+        ret = reader_varint(r, &len);
+
+    for (uint64_t i = 0; i < len && ret == LLIST_OK; i++) {
+        uint64_t n = 0;
+        ret = reader_varint(r, &n);
+        if (ret == LLIST_OK && (n == 0 || n > SIZE_MAX))
+            ret = LLIST_IO_ERR;
+        if (ret != LLIST_OK)
+            break;
+
+        if (r->end - r->pos < n && n <= LLIST_IO_BUF) {   // make room
+            memmove(r->buf, r->buf + r->pos, r->end - r->pos);
+            r->end -= r->pos;
+            r->pos = 0;
+            while (ret == LLIST_OK && r->end < n)
+                ret = reader_fill(r);
+        }
+        if (ret == LLIST_OK && r->end - r->pos >= n) {  // element in buf
+            ret = llist_add(l, r->buf + r->pos, (size_t)n);
+            r->pos += (size_t)n;
+        } else if (ret == LLIST_OK) {                   // element too large
+            void *d = NULL;
+            ret = llist_add_uninit(l, (size_t)n, &d);   // read in place
+            if (ret == LLIST_OK)
+                ret = reader_read(r, d, (size_t)n);
+            if (ret != LLIST_OK && d != NULL)
+                llist_load_drop(l);
+        }
+    }
+    free(r);
+    LLIST_TRACE_EVENT(LLIST_OP_LOAD, LLIST_TRACE_EXIT, l, 0, 0, 0);
+    return ret;
+}
+
+// Queues the bytes staged since the last iovec as a new iovec. 
+//
+// PARAMS: 
+// w - the writer to seal
+static void writer_seal(lwriter_t *w) {
+    if (w->used > w->mark) {
+        w->iov[w->cnt].iov_base = w->buf + w->mark;
+        w->iov[w->cnt].iov_len = w->used - w->mark;
+        w->cnt++;
+        w->mark = w->used;
+    }
+}
+
+// Writes every queued iovec, retrying partial and interrupted writes. 
+//
+// PARAMS: 
+// w - the writer to flush
+//
+// RET: 
+// Zero on success, non-zero on error. 
+static int writer_flush(lwriter_t *w) {
+    writer_seal(w);
+    struct iovec *iov = w->iov;
+    int cnt = w->cnt;
+    while (cnt > 0) {
+        ssize_t n = writev(w->fd, iov, cnt);
+        if (n < 0 && errno == EINTR)
+            continue;
+        if (n <= 0)
+            return LLIST_IO_ERR;
+
+        while (cnt > 0 && (size_t)n >= iov->iov_len) {
+            n -= (ssize_t)iov->iov_len;
+            iov++;
+            cnt--;
+        }
+        if (cnt > 0) {
+            iov->iov_base = (unsigned char *)iov->iov_base + n;
+            iov->iov_len -= (size_t)n;
+        }
+    }
+    w->used = 0;
+    w->mark = 0;
+    w->cnt = 0;
+    return LLIST_OK;
+}
+
+// Stages a copy of the given bytes, flushing first if they do not fit. 
+//
+// PARAMS: 
+// w - the writer to stage in
+// d - the bytes to stage
+// n - the number of bytes, at most LLIST_IO_BUF
+//
+// RET: 
+// Zero on success, non-zero on error. 
+static int writer_copy(lwriter_t *w, const void *d, size_t n) {
+    if (w->used + n > LLIST_IO_BUF || w->cnt >= LLIST_IO_IOV - 1) {
+        int ret = writer_flush(w);
+        if (ret != LLIST_OK)
+            return ret;
+    }
+    memcpy(w->buf + w->used, d, n);
+    w->used += n;
+    return LLIST_OK;
+}
+
+// Queues the given bytes to be written in place, without copying. 
+//
+// PARAMS: 
+// w - the writer to queue in
+// d - the bytes to write, kept alive until the next flush
+// n - the number of bytes
+//
+// RET: 
+// Zero on success, non-zero on error. 
+static int writer_ref(lwriter_t *w, const void *d, size_t n) {
+    if (w->cnt >= LLIST_IO_IOV - 2) {       // room to seal buf first
+        int ret = writer_flush(w);
+        if (ret != LLIST_OK)
+            return ret;
+    }
+    writer_seal(w);
+    w->iov[w->cnt].iov_base = (void *)d;
+    w->iov[w->cnt].iov_len = n;
+    w->cnt++;
+    return LLIST_OK;
+}
+
+// Stages the given value as an unsigned LEB128 varint. 
+//
+// PARAMS: 
+// w - the writer to stage in
+// v - the value to stage
+//
+// RET: 
+// Zero on success, non-zero on error. 
+static int writer_varint(lwriter_t *w, uint64_t v) {
+    unsigned char b[LLIST_IO_VARINT];
+    size_t n = 0;
+    do {
+        b[n] = (unsigned char)(v & 0x7f);
+        v >>= 7;
+        if (v != 0)
+            b[n] |= 0x80;
+        n++;
+    } while (v != 0);
+    return writer_copy(w, b, n);
+}
+
+// Reads more bytes into the free space at the end of the reader buffer. 
+//
+// PARAMS: 
+// r - the reader to fill
+//
+// RET: 
+// Zero on success, non-zero on error or end of file. 
+static int reader_fill(lreader_t *r) {
+    for (;;) {
+        ssize_t n = read(r->fd, r->buf + r->end, LLIST_IO_BUF - r->end);
+        if (n < 0 && errno == EINTR)
+            continue;
+        if (n <= 0)
+            return LLIST_IO_ERR;
+        r->end += (size_t)n;
+        return LLIST_OK;
+    }
+}
+
+// Reads exactly the given number of bytes. Bytes already buffered are copied 
+// first, and the rest is read straight into d. 
+//
+// PARAMS: 
+// r - the reader to read from
+// d - where to store the bytes
+// n - the number of bytes
+//
+// RET: 
+// Zero on success, non-zero on error or end of file. 
+static int reader_read(lreader_t *r, void *d, size_t n) {
+    unsigned char *out = d;
+    size_t avail = r->end - r->pos;
+    size_t take = (avail < n) ? avail : n;
+    memcpy(out, r->buf + r->pos, take);
+    r->pos += take;
+    out += take;
+    n -= take;
+
+    if (n >= LLIST_IO_BUF) {                // skip the buffer entirely
+        while (n > 0) {
+            ssize_t got = read(r->fd, out, n);
+            if (got < 0 && errno == EINTR)
+                continue;
+            if (got <= 0)
+                return LLIST_IO_ERR;
+            out += got;
+            n -= (size_t)got;
+        }
+        return LLIST_OK;
+    }
+
+    if (n > 0) {
+        r->pos = 0;
+        r->end = 0;
+        while (r->end < n) {
+            int ret = reader_fill(r);
+            if (ret != LLIST_OK)
+                return ret;
+        }
+        memcpy(out, r->buf, n);
+        r->pos = n;
+    }
+    return LLIST_OK;
+}
+
+// Reads an unsigned LEB128 varint. 
+//
+// PARAMS: 
+// r - the reader to read from
+// v - where to store the value
+//
+// RET: 
+// Zero on success, non-zero on error or end of file. 
+static int reader_varint(lreader_t *r, uint64_t *v) {
+    *v = 0;
+    for (int shift = 0; shift < 7 * LLIST_IO_VARINT; shift += 7) {
+        unsigned char b = 0;
+        int ret = reader_read(r, &b, 1);
+        if (ret != LLIST_OK)
+            return ret;
+        *v |= (uint64_t)(b & 0x7f) << shift;
+        if ((b & 0x80) == 0)
+            return LLIST_OK;
+    }
+    return LLIST_IO_ERR;                    // varint too long
+}
+
+// Deletes the element at the tail of the given linked list, which a failed 
+// read left partly filled. 
+//
+// PARAMS: 
+// l - the linked list to have the element deleted
+static void llist_load_drop(llist_t *l) {
+    void *d = llist_del(l, SIZE_MAX);
+    if (l->chunk == 0)
+        free(d);                    // arena elements go with their chunk
+}
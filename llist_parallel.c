@@ -0,0 +1,221 @@
+///////////////////////////////////////////////////////////////////////////////
+// llist_parallel.c
+// Linked list parallel traversal in C99 and POSIX threads. 
+//
+// One sequential pass records the first node of every chunk, after which the 
+// chunks are walked concurrently. Chunk j is handled by thread j % nthreads, 
+// and reductions keep one accumulator per chunk, combined in list order. 
+//
+// Author: agent
+// Date:   17/10/2026
+///////////////////////////////////////////////////////////////////////////////
+
+#define _POSIX_C_SOURCE 200809L
+#include "llist.h"
+#include <pthread.h>
+#include <unistd.h>
+
+#define LLIST_PAR_MIN 4096                  // fewest elements per chunk
+#define LLIST_PAR_CHUNKS 1024               // most chunks per list
+
+// The parallel job type, shared by every worker. 
+typedef struct llist_job_t {
+    lnode_t **starts;                       // first node of each chunk
+    size_t chunks;                          // number of chunks
+    size_t per;                             // elements per chunk
+    size_t len;                             // list size
+    size_t nthreads;                        // number of workers
+    llist_apply_fn fn;                      // for_each function, or NULL
+    void *ctx;                              // for_each context
+    const llist_reducer_t *r;               // reduction, or NULL
+    unsigned char *accs;                    // accumulator of each chunk
+} ljob_t;
+
+// The worker type, one per thread. 
+typedef struct llist_worker_t {
+    ljob_t *job;                            // the shared job
+    size_t id;                              // first chunk of the worker
+    pthread_t tid;                          // thread running the worker
+} lworker_t;
+
+static size_t threads_default(void);
+static int job_split(ljob_t *job, const llist_t *l);
+static int job_run(ljob_t *job);
+static void *worker_run(void *arg);
+
+// Calls the given function on every element of the specified linked list, 
+// using the given number of threads. The list is split into chunks in one 
+// pass, and chunks are striped across the threads. The function must be safe 
+// to call concurrently on different elements. 
+//
+// PARAMS: 
+// l        - the linked list to traverse
+// fn       - the function to call with each element
+// ctx      - the context passed to fn
+// nthreads - the number of threads, or 0 for one per online CPU
+//
+// RET: 
+// Zero on success, non-zero on error. 
+int llist_parallel_for_each(llist_t *l, llist_apply_fn fn, void *ctx, 
+        size_t nthreads) {
+    if (l == NULL || fn == NULL)
+        return LLIST_NULL_ERR;
+
+    LLIST_TRACE_EVENT(LLIST_OP_FOR_EACH, LLIST_TRACE_ENTER, l, 0, 0, 0);
+    ljob_t job = {0};
+    job.fn = fn;
+    job.ctx = ctx;
+    job.len = l->len;
+    job.nthreads = (nthreads == 0) ? threads_default() : nthreads;
+    int ret = LLIST_OK;
+    if (l->len != 0)
+        ret = job_split(&job, l);
+    if (ret == LLIST_OK && l->len != 0)
+        ret = job_run(&job);
+    free(job.starts);
+    LLIST_TRACE_EVENT(LLIST_OP_FOR_EACH, LLIST_TRACE_EXIT, l, 0, 0, 0);
+    return ret;
+}
+
+// Reduces every element of the specified linked list into out, using the 
+// given number of threads. The map and combine functions must be safe to call 
+// concurrently on different accumulators. 
+//
+// PARAMS: 
+// l        - the linked list to reduce
+// r        - the reduction to run
+// out      - where to store the result, r->size bytes
+// nthreads - the number of threads, or 0 for one per online CPU
+//
+// RET: 
+// Zero on success, non-zero on error. 
+int llist_parallel_reduce(const llist_t *l, const llist_reducer_t *r, 
+        void *out, size_t nthreads) {
+    if (l == NULL || r == NULL || out == NULL || r->map == NULL || 
+        r->combine == NULL || r->identity == NULL || r->size == 0)
+        return LLIST_NULL_ERR;
+
+    LLIST_TRACE_EVENT(LLIST_OP_REDUCE, LLIST_TRACE_ENTER, l, 0, 0, 0);
+    memcpy(out, r->identity, r->size);
+    ljob_t job = {0};
+    job.r = r;
+    job.len = l->len;
+    job.nthreads = (nthreads == 0) ? threads_default() : nthreads;
+    int ret = LLIST_OK;
+    if (l->len != 0)
+        ret = job_split(&job, l);
+    if (ret == LLIST_OK && l->len != 0) {
+        job.accs = malloc(job.chunks * r->size);
+        ret = (job.accs != NULL) ? LLIST_OK : LLIST_ALLOC_ERR;
+    }
+
+    for (size_t i = 0; i < job.chunks && job.accs != NULL; i++)
+        memcpy(job.accs + i * r->size, r->identity, r->size);
+    if (ret == LLIST_OK && l->len != 0)
+        ret = job_run(&job);
+    for (size_t i = 0; i < job.chunks && ret == LLIST_OK; i++)
+        r->combine(out, job.accs + i * r->size, r->ctx);
+    free(job.starts);
+    free(job.accs);
+    LLIST_TRACE_EVENT(LLIST_OP_REDUCE, LLIST_TRACE_EXIT, l, 0, 0, 0);
+    return ret;
+}
+
+// Returns the number of online CPUs, or 1 if it is unknown. 
+//
+// RET: 
+// The default number of threads. 
+static size_t threads_default(void) {
+    long n = sysconf(_SC_NPROCESSORS_ONLN);
+    return (n > 0) ? (size_t)n : 1;
+}
+
+// Splits the given linked list into chunks for a job, recording the first 
+// node of each chunk in one pass. The chunk size only depends on the list 
+// size. 
+//
+// PARAMS: 
+// job - the job to split for
+// l   - the non-empty linked list to split
+//
+// RET: 
+// Zero on success, non-zero on error. 
+static int job_split(ljob_t *job, const llist_t *l) {
+    job->per = (l->len + LLIST_PAR_CHUNKS - 1) / LLIST_PAR_CHUNKS;
+    job->per = (job->per < LLIST_PAR_MIN) ? LLIST_PAR_MIN : job->per;
+    job->chunks = (l->len + job->per - 1) / job->per;
+    job->starts = malloc(job->chunks * sizeof *job->starts);
+    if (job->starts == NULL)
+        return LLIST_ALLOC_ERR;
+
+    lnode_t *n = l->head;
+    for (size_t i = 0; i < job->chunks; i++) {
+        job->starts[i] = n;
+        for (size_t j = 0; j < job->per && n != NULL; j++)
+            n = n->next;
+    }
+    return LLIST_OK;
+}
+
+// Runs the given job on its threads. The calling thread works too, and takes 
+// over the chunks of any thread that could not be started. 
+//
+// PARAMS: 
+// job - the job to run
+//
+// RET: 
+// Zero on success, non-zero on error. 
+static int job_run(ljob_t *job) {
+    if (job->nthreads > job->chunks)
+        job->nthreads = job->chunks;
+    lworker_t *w = malloc(job->nthreads * sizeof *w);
+    if (w == NULL)
+        return LLIST_ALLOC_ERR;
+
+    size_t started = 1;
+    for (; started < job->nthreads; started++) {
+        w[started].job = job;
+        w[started].id = started;
+        if (pthread_create(&w[started].tid, NULL, worker_run, &w[started]))
+            break;
+    }
+    for (size_t i = 0; i < job->nthreads; i++) {
+        if (i == 0 || i >= started) {       // caller runs unstarted workers
+            w[i].job = job;
+            w[i].id = i;
+            worker_run(&w[i]);
+        }
+    }
+    for (size_t i = 1; i < started; i++)
+        pthread_join(w[i].tid, NULL);
+    free(w);
+    return LLIST_OK;
+}
+
+// Walks every chunk assigned to the given worker. 
+//
+// PARAMS: 
+// arg - the worker to run
+//
+// RET: 
+// Always NULL. 
+static void *worker_run(void *arg) {
+    lworker_t *w = arg;
+    ljob_t *job = w->job;
+    for (size_t c = w->id; c < job->chunks; c += job->nthreads) {
+        size_t cnt = (c == job->chunks - 1) ? 
+            (job->len - c * job->per) : job->per;
+        lnode_t *n = job->starts[c];
+        if (job->r != NULL) {
+            const llist_reducer_t *r = job->r;
+            void *acc = job->accs + c * r->size;
+            for (size_t i = 0; i < cnt; i++, n = n->next)
+                r->map(acc, lnode_data(n), n->size, r->ctx);
+        } else {
+            for (size_t i = 0; i < cnt; i++, n = n->next)
+                job->fn(lnode_data(n), n->size, job->ctx);
+        }
+    }
+    return NULL;
+}
+
@@ -0,0 +1,507 @@
+///////////////////////////////////////////////////////////////////////////////
+// llist_stream.c
+// Linked list streaming compressed export and import in C99. 
+//
+// The stream is the magic "LLZ1" followed by frames. Each frame is a codec 
+// byte, the raw and encoded sizes as 32-bit little endian values, then the 
+// encoded block. A frame with a raw size of 0 ends the stream. Concatenated 
+// raw blocks hold every element as an LEB128 varint size followed by its 
+// bytes, and elements may span blocks. 
+//
+// The LZ codec is a byte-oriented LZ77 in the style of LZ4. A sequence is a 
+// token (literal length in the high nibble, match length - 4 in the low 
+// nibble, 15 meaning more length bytes follow), the literals, then a 16-bit 
+// little endian match offset. The last sequence of a block has literals only. 
+//
+// Author: agent
+// Date:   17/10/2026
+///////////////////////////////////////////////////////////////////////////////
+
+#include "llist.h"
+#include <stdint.h>
+
+#define LLIST_STREAM_MAGIC "LLZ1"
+#define LLIST_FRAME_HDR 9                   // codec, raw size, encoded size
+#define LZ_MIN_MATCH 4                      // shortest match encoded
+#define LZ_MAX_OFFSET 65535                 // furthest match reachable
+#define LZ_HASH_BITS 12                     // log2 of hash table entries
+#define LZ_BOUND(n) ((n) + (n) / 255 + 16)  // worst case encoded size
+
+// The stream exporter type. 
+typedef struct llist_exporter_t {
+    llist_writer_fn w;                      // output callback
+    void *ctx;                              // output callback context
+    int codec;                              // codec for every block
+    size_t used;                            // raw bytes in raw
+    uint32_t table[1 << LZ_HASH_BITS];      // LZ match candidates
+    unsigned char raw[LLIST_STREAM_BLOCK];  // raw block being filled
+    unsigned char enc[LLIST_FRAME_HDR + LZ_BOUND(LLIST_STREAM_BLOCK)];
+} lexporter_t;
+
+// The stream importer type. 
+typedef struct llist_importer_t {
+    llist_reader_fn r;                      // input callback
+    void *ctx;                              // input callback context
+    unsigned char *elem;                    // element spanning blocks
+    size_t elem_cap;                        // capacity of elem
+    size_t size;                            // size of the current element
+    size_t got;                             // bytes of it seen so far
+    int shift;                              // varint shift, -1 once read
+    unsigned char raw[LLIST_STREAM_BLOCK];  // decoded block
+    unsigned char enc[LZ_BOUND(LLIST_STREAM_BLOCK)];
+} limporter_t;
+
+static int exporter_put(lexporter_t *e, const void *d, size_t n);
+static int exporter_flush(lexporter_t *e);
+static int importer_read(limporter_t *im, void *d, size_t n);
+static int importer_parse(limporter_t *im, llist_t *l, size_t n);
+static size_t lz_compress(const unsigned char *src, size_t n,
+        unsigned char *dst, uint32_t *table);
+static int lz_decompress(const unsigned char *src, size_t n,
+        unsigned char *dst, size_t raw);
+static unsigned char *lz_length(unsigned char *op, size_t len);
+static inline uint32_t lz_read32(const unsigned char *p);
+static inline void put32(unsigned char *p, uint32_t v);
+static inline uint32_t get32(const unsigned char *p);
+
+// Exports the given linked list as a stream of framed blocks in one pass. 
+// Elements are packed into blocks of LLIST_STREAM_BLOCK bytes, and each block 
+// is compressed with the given codec when that makes it smaller. 
+//
+// PARAMS: 
+// l     - the linked list to export
+// w     - the callback receiving the encoded stream
+// ctx   - the context passed to w
+// codec - LLIST_CODEC_NONE or LLIST_CODEC_LZ
+//
+// RET: 
+// Zero on success, non-zero on error. 
+int llist_export_stream(const llist_t *l, llist_writer_fn w, void *ctx,
+        int codec) {
+    if (l == NULL || w == NULL ||
+        (codec != LLIST_CODEC_NONE && codec != LLIST_CODEC_LZ))
+        return LLIST_NULL_ERR;
+
+    lexporter_t *e = malloc(sizeof *e);
+    if (e == NULL)
+        return LLIST_ALLOC_ERR;
+
+    LLIST_TRACE_EVENT(LLIST_OP_EXPORT, LLIST_TRACE_ENTER, l, 0, 0, 0);
+    e->w = w;
+    e->ctx = ctx;
+    e->codec = codec;
+    e->used = 0;
+    int ret = (w(ctx, LLIST_STREAM_MAGIC, 4) == 0) ? LLIST_OK : LLIST_IO_ERR;
+    for (lnode_t *n = l->head; n != NULL && ret == LLIST_OK; n = n->next) {
+        unsigned char v[10];
+        size_t len = 0;
+        size_t size = n->size;
+        do {
+            v[len++] = (unsigned char)((size & 0x7f) |
+                (size > 0x7f ? 0x80 : 0));
+            size >>= 7;
+        } while (size != 0);
+        ret = exporter_put(e, v, len);
+        if (ret == LLIST_OK)
+            ret = exporter_put(e, lnode_data(n), n->size);
+    }
+    if (ret == LLIST_OK)
+        ret = exporter_flush(e);
+    if (ret == LLIST_OK) {                  // end of stream frame
+        unsigned char end[LLIST_FRAME_HDR] = {LLIST_CODEC_NONE};
+        ret = (w(ctx, end, sizeof end) == 0) ? LLIST_OK : LLIST_IO_ERR;
+    }
+    free(e);
+    LLIST_TRACE_EVENT(LLIST_OP_EXPORT, LLIST_TRACE_EXIT, l, 0, 0, 0);
+    return ret;
+}
+
+// Imports a stream written by llist_export_stream block by block, adding 
+// every element to the end of the given linked list. Memory use is bounded by 
+// two blocks plus the largest element. On error, the elements read so far 
+// stay in the list. 
+//
+// PARAMS: 
+// l   - the linked list to have the elements added
+// r   - the callback providing the encoded stream
+// ctx - the context passed to r
+//
+// RET: 
+// Zero on success, non-zero on error. 
+int llist_import_stream(llist_t *l, llist_reader_fn r, void *ctx) {
+    if (l == NULL || r == NULL)
+        return LLIST_NULL_ERR;
+
+    limporter_t *im = malloc(sizeof *im);
+    if (im == NULL)
+        return LLIST_ALLOC_ERR;
+
+    LLIST_TRACE_EVENT(LLIST_OP_IMPORT, LLIST_TRACE_ENTER, l, 0, 0, 0);
+    im->r = r;
+    im->ctx = ctx;
+    im->elem = NULL;
+    im->elem_cap = 0;
+    im->size = 0;
+    im->got = 0;
+    im->shift = 0;
+    unsigned char hdr[LLIST_FRAME_HDR];
+    int ret = importer_read(im, hdr, 4);
+    if (ret == LLIST_OK && memcmp(hdr, LLIST_STREAM_MAGIC, 4) != 0)
+        ret = LLIST_IO_ERR;
+
+    while (ret == LLIST_OK) {
+        ret = importer_read(im, hdr, sizeof hdr);
+        if (ret != LLIST_OK)
+            break;
+
+        uint32_t raw = get32(hdr + 1);
+        uint32_t enc = get32(hdr + 5);
+        if (raw == 0) {                     // end of stream
+            if (im->shift != 0)
+                ret = LLIST_IO_ERR;         // truncated element
+            break;
+        }
+        if (raw > LLIST_STREAM_BLOCK || (hdr[0] == LLIST_CODEC_NONE ?
+            enc != raw : (hdr[0] != LLIST_CODEC_LZ || enc > sizeof im->enc))) {
+            ret = LLIST_IO_ERR;
+            break;
+        }
+
+        if (hdr[0] == LLIST_CODEC_NONE) {
+            ret = importer_read(im, im->raw, raw);
+        } else {
+            ret = importer_read(im, im->enc, enc);
+            if (ret == LLIST_OK)
+                ret = lz_decompress(im->enc, enc, im->raw, raw);
+        }
+        if (ret == LLIST_OK)
+            ret = importer_parse(im, l, raw);
+    }
+    free(im->elem);
+    free(im);
+    LLIST_TRACE_EVENT(LLIST_OP_IMPORT, LLIST_TRACE_EXIT, l, 0, 0, 0);
+    return ret;
+}
+
+// Appends bytes to the raw block, emitting full blocks as they fill up. 
+//
+// PARAMS: 
+// e - the exporter to append to
+// d - the bytes to append
+// n - the number of bytes
+//
+// RET: 
+// Zero on success, non-zero on error. 
+static int exporter_put(lexporter_t *e, const void *d, size_t n) {
+    const unsigned char *p = d;
+    while (n > 0) {
+        size_t take = LLIST_STREAM_BLOCK - e->used;
+        take = (take < n) ? take : n;
+        memcpy(e->raw + e->used, p, take);
+        e->used += take;
+        p += take;
+        n -= take;
+        if (e->used == LLIST_STREAM_BLOCK) {
+            int ret = exporter_flush(e);
+            if (ret != LLIST_OK)
+                return ret;
+        }
+    }
+    return LLIST_OK;
+}
+
+// Encodes the raw block as one frame and passes it to the writer. The block 
+// is stored raw if compressing it does not save space. 
+//
+// PARAMS: 
+// e - the exporter to flush
+//
+// RET: 
+// Zero on success, non-zero on error. 
+static int exporter_flush(lexporter_t *e) {
+    if (e->used == 0)
+        return LLIST_OK;
+
+    size_t enc = 0;
+    if (e->codec == LLIST_CODEC_LZ)
+        enc = lz_compress(e->raw, e->used, e->enc + LLIST_FRAME_HDR, e->table);
+
+    int ret = LLIST_OK;
+    if (enc != 0 && enc < e->used) {
+        e->enc[0] = LLIST_CODEC_LZ;
+        put32(e->enc + 1, (uint32_t)e->used);
+        put32(e->enc + 5, (uint32_t)enc);
+        if (e->w(e->ctx, e->enc, LLIST_FRAME_HDR + enc) != 0)
+            ret = LLIST_IO_ERR;
+    } else {
+        unsigned char hdr[LLIST_FRAME_HDR] = {LLIST_CODEC_NONE};
+        put32(hdr + 1, (uint32_t)e->used);
+        put32(hdr + 5, (uint32_t)e->used);
+        if (e->w(e->ctx, hdr, sizeof hdr) != 0 ||
+            e->w(e->ctx, e->raw, e->used) != 0)
+            ret = LLIST_IO_ERR;
+    }
+    e->used = 0;
+    return ret;
+}
+
+// Reads exactly the given number of bytes from the stream. 
+//
+// PARAMS: 
+// im - the importer to read with
+// d  - where to store the bytes
+// n  - the number of bytes
+//
+// RET: 
+// Zero on success, non-zero on error or end of stream. 
+static int importer_read(limporter_t *im, void *d, size_t n) {
+    unsigned char *p = d;
+    while (n > 0) {
+        size_t got = im->r(im->ctx, p, n);
+        if (got == 0 || got > n)
+            return LLIST_IO_ERR;
+        p += got;
+        n -= got;
+    }
+    return LLIST_OK;
+}
+
+// Parses the elements in a decoded block, carrying over an element that 
+// continues into the next block. Elements fully inside the block are added 
+// straight from it. 
+//
+// PARAMS: 
+// im - the importer holding the decoded block
+// l  - the linked list to have the elements added
+// n  - the size of the decoded block
+//
+// RET: 
+// Zero on success, non-zero on error. 
+static int importer_parse(limporter_t *im, llist_t *l, size_t n) {
+    size_t pos = 0;
+    while (pos < n) {
+        if (im->shift >= 0) {               // reading the element size
+            unsigned char b = im->raw[pos++];
+            if (im->shift >= 64 ||
+                (im->shift > 0 && (b & 0x7f) > (SIZE_MAX >> im->shift)))
+                return LLIST_IO_ERR;
+            im->size |= (size_t)(b & 0x7f) << im->shift;
+            im->shift += 7;
+            if ((b & 0x80) == 0) {
+                if (im->size == 0)
+                    return LLIST_IO_ERR;
+                im->shift = -1;
+                im->got = 0;
+            }
+            continue;
+        }
+
+        int ret = LLIST_OK;
+        size_t avail = n - pos;
+        if (im->got == 0 && avail >= im->size) {        // element in block
+            ret = llist_add(l, im->raw + pos, im->size);
+            pos += im->size;
+        } else {                                        // element spans
+            if (im->elem_cap < im->size) {
+                unsigned char *b = realloc(im->elem, im->size);
+                if (b == NULL)
+                    return LLIST_ALLOC_ERR;
+                im->elem = b;
+                im->elem_cap = im->size;
+            }
+            size_t take = im->size - im->got;
+            take = (take < avail) ? take : avail;
+            memcpy(im->elem + im->got, im->raw + pos, take);
+            im->got += take;
+            pos += take;
+            if (im->got < im->size)
+                continue;
+            ret = llist_add(l, im->elem, im->size);
+        }
+        if (ret != LLIST_OK)
+            return ret;
+        im->size = 0;
+        im->shift = 0;
+    }
+    return LLIST_OK;
+}
+
+// Compresses a block with the LZ codec. 
+//
+// PARAMS: 
+// src   - the block to compress
+// n     - the size of the block
+// dst   - where to store the output, at least LZ_BOUND(n) bytes
+// table - the match candidate table
+//
+// RET: 
+// The size of the compressed block. 
+static size_t lz_compress(const unsigned char *src, size_t n,
+        unsigned char *dst, uint32_t *table) {
+    memset(table, 0, sizeof(uint32_t) << LZ_HASH_BITS);
+    unsigned char *op = dst;
+    size_t anchor = 0;
+    size_t ip = 0;
+    while (n >= LZ_MIN_MATCH && ip <= n - LZ_MIN_MATCH) {
+        uint32_t v = lz_read32(src + ip);
+        uint32_t h = (v * 2654435761u) >> (32 - LZ_HASH_BITS);
+        size_t ref = table[h];              // position + 1, or 0 if none
+        table[h] = (uint32_t)(ip + 1);
+        if (ref == 0 || ip - (ref - 1) > LZ_MAX_OFFSET ||
+            lz_read32(src + ref - 1) != v) {
+            ip += 1 + ((ip - anchor) >> 6); // skip faster on literal runs
+            continue;
+        }
+
+        ref--;
+        size_t len = LZ_MIN_MATCH;
+        while (ip + len < n && src[ref + len] == src[ip + len])
+            len++;
+
+        size_t lit = ip - anchor;
+        unsigned char *token = op++;
+        *token = (unsigned char)(((lit < 15) ? lit : 15) << 4);
+        if (lit >= 15)
+            op = lz_length(op, lit - 15);
+        memcpy(op, src + anchor, lit);
+        op += lit;
+        *op++ = (unsigned char)((ip - ref) & 0xff);
+        *op++ = (unsigned char)((ip - ref) >> 8);
+        size_t m = len - LZ_MIN_MATCH;
+        *token |= (unsigned char)((m < 15) ? m : 15);
+        if (m >= 15)
+            op = lz_length(op, m - 15);
+
+        ip += len;
+        anchor = ip;
+    }
+
+    size_t lit = n - anchor;                // last literals
+    *op++ = (unsigned char)(((lit < 15) ? lit : 15) << 4);
+    if (lit >= 15)
+        op = lz_length(op, lit - 15);
+    memcpy(op, src + anchor, lit);
+    op += lit;
+    return (size_t)(op - dst);
+}
+
+// Decompresses a block encoded with the LZ codec, checking every length and 
+// offset against the buffers. 
+//
+// PARAMS: 
+// src - the encoded block
+// n   - the size of the encoded block
+// dst - where to store the decoded block
+// raw - the expected size of the decoded block
+//
+// RET: 
+// Zero on success, non-zero if the block is corrupt. 
+static int lz_decompress(const unsigned char *src, size_t n,
+        unsigned char *dst, size_t raw) {
+    size_t ip = 0;
+    size_t op = 0;
+    for (;;) {
+        if (ip >= n)
+            return LLIST_IO_ERR;
+        unsigned char token = src[ip++];
+
+        size_t lit = token >> 4;
+        if (lit == 15) {
+            unsigned char b = 255;
+            while (b == 255) {
+                if (ip >= n)
+                    return LLIST_IO_ERR;
+                b = src[ip++];
+                lit += b;
+            }
+        }
+        if (lit > n - ip || lit > raw - op)
+            return LLIST_IO_ERR;
+        memcpy(dst + op, src + ip, lit);
+        ip += lit;
+        op += lit;
+        if (op == raw)                      // last sequence
+            return (ip == n) ? LLIST_OK : LLIST_IO_ERR;
+
+        if (n - ip < 2)
+            return LLIST_IO_ERR;
+        size_t off = (size_t)src[ip] | ((size_t)src[ip + 1] << 8);
+        ip += 2;
+        size_t len = token & 15;
+        if (len == 15) {
+            unsigned char b = 255;
+            while (b == 255) {
+                if (ip >= n)
+                    return LLIST_IO_ERR;
+                b = src[ip++];
+                len += b;
+            }
+        }
+        len += LZ_MIN_MATCH;
+        if (off == 0 || off > op || len > raw - op)
+            return LLIST_IO_ERR;
+
+        if (off >= len) {
+            memcpy(dst + op, dst + op - off, len);
+            op += len;
+        } else {                            // overlapping copy
+            for (size_t j = 0; j < len; j++, op++)
+                dst[op] = dst[op - off];
+        }
+    }
+}
+
+// Writes the extra bytes of a sequence length. 
+//
+// PARAMS: 
+// op  - where to write
+// len - the length beyond the token nibble
+//
+// RET: 
+// The position after the bytes written. 
+static unsigned char *lz_length(unsigned char *op, size_t len) {
+    while (len >= 255) {
+        *op++ = 255;
+        len -= 255;
+    }
+    *op++ = (unsigned char)len;
+    return op;
+}
+
+// Reads 4 bytes in native byte order, for comparing and hashing matches. 
+//
+// PARAMS: 
+// p - the bytes to read
+//
+// RET: 
+// The 4 bytes as an integer. 
+static inline uint32_t lz_read32(const unsigned char *p) {
+    uint32_t v;
+    memcpy(&v, p, sizeof v);
+    return v;
+}
+
+// Writes a 32-bit little endian value. 
+//
+// PARAMS: 
+// p - where to write
+// v - the value to write
+static inline void put32(unsigned char *p, uint32_t v) {
+    p[0] = (unsigned char)v;
+    p[1] = (unsigned char)(v >> 8);
+    p[2] = (unsigned char)(v >> 16);
+    p[3] = (unsigned char)(v >> 24);
+}
+
+// Reads a 32-bit little endian value. 
+//
+// PARAMS: 
+// p - the bytes to read
+//
+// RET: 
+// The value read. 
+static inline uint32_t get32(const unsigned char *p) {
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) |
+        ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
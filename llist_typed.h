@@ -0,0 +1,150 @@
+///////////////////////////////////////////////////////////////////////////////
+// llist_typed.h
+// Typed linked list specialisations in C99.
+//
+// LLIST_DEFINE(name, T) generates a linked list of T named name_t, with the
+// element stored inline in each node and copied by value. Every function is
+// static inline, so element copies have a compile time size.
+//
+//     LLIST_DEFINE(ilist, int)
+//     ilist_t l;
+//     ilist_init(&l);
+//     ilist_add(&l, 42);
+//
+// Author: agent
+// Date:   17/10/2026
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef LLIST_TYPED_H
+#define LLIST_TYPED_H
+#include "llist.h"
+
+#define LLIST_DEFINE(name, T) \
+ \
+/* The typed linked list node type. */ \
+typedef struct name##_node_t { \
+    struct name##_node_t *prev;             /* pointer to previous */ \
+    struct name##_node_t *next;             /* pointer to next */ \
+    T data;                                 /* internal data */ \
+} name##_node_t; \
+ \
+/* The typed linked list type. */ \
+typedef struct name##_t { \
+    name##_node_t *head;                    /* list head */ \
+    name##_node_t *tail;                    /* list tail */ \
+    size_t len;                             /* list size */ \
+} name##_t; \
+ \
+/* Initialises the specified linked list. */ \
+static inline int name##_init(name##_t *l) { \
+    if (l == NULL) \
+        return LLIST_NULL_ERR; \
+    l->head = NULL; \
+    l->tail = NULL; \
+    l->len = 0; \
+    return LLIST_OK; \
+} \
+ \
+/* Returns the node at the given index, or the last node if out of range. */ \
+static inline name##_node_t *name##_node(const name##_t *l, size_t i) { \
+    if (l == NULL || l->len == 0) \
+        return NULL; \
+    name##_node_t *ret = NULL; \
+    i = (i >= l->len) ? (l->len - 1) : i; \
+    if (i >= l->len / 2) { \
+        ret = l->tail; \
+        for (size_t j = 0; j < (l->len - i - 1); j++) \
+            ret = ret->prev; \
+    } else { \
+        ret = l->head; \
+        for (size_t j = 0; j < i; j++) \
+            ret = ret->next; \
+    } \
+    return ret; \
+} \
+ \
+/* Returns the element at the given index, or the last if out of range. */ \
+static inline T *name##_get(const name##_t *l, size_t i) { \
+    name##_node_t *node = name##_node(l, i); \
+    return (node != NULL) ? &node->data : NULL; \
+} \
+ \
+/* Adds a copy of the given element to the end of the linked list. */ \
+static inline int name##_add(name##_t *l, T d) { \
+    if (l == NULL) \
+        return LLIST_NULL_ERR; \
+    name##_node_t *add = malloc(sizeof *add); \
+    if (add == NULL) \
+        return LLIST_ALLOC_ERR; \
+    add->data = d; \
+    add->next = NULL; \
+    add->prev = l->tail; \
+    if (l->len == 0) \
+        l->head = add; \
+    else \
+        l->tail->next = add; \
+    l->tail = add; \
+    l->len++; \
+    return LLIST_OK; \
+} \
+ \
+/* Inserts a copy of the given element at the given index. */ \
+static inline int name##_ins(name##_t *l, T d, size_t i) { \
+    if (l == NULL) \
+        return LLIST_NULL_ERR; \
+    if (i >= l->len) \
+        return name##_add(l, d); \
+    name##_node_t *ins = malloc(sizeof *ins); \
+    if (ins == NULL) \
+        return LLIST_ALLOC_ERR; \
+    name##_node_t *aft = name##_node(l, i); \
+    ins->data = d; \
+    ins->next = aft; \
+    ins->prev = aft->prev; \
+    if (aft->prev == NULL) \
+        l->head = ins; \
+    else \
+        aft->prev->next = ins; \
+    aft->prev = ins; \
+    l->len++; \
+    return LLIST_OK; \
+} \
+ \
+/* Deletes the element at the given index, or the last if out of range, */ \
+/* copying it to out if out is not NULL. */ \
+static inline int name##_del(name##_t *l, size_t i, T *out) { \
+    name##_node_t *node = name##_node(l, i); \
+    if (node == NULL) \
+        return LLIST_NULL_ERR; \
+    if (node->prev == NULL) \
+        l->head = node->next; \
+    else \
+        node->prev->next = node->next; \
+    if (node->next == NULL) \
+        l->tail = node->prev; \
+    else \
+        node->next->prev = node->prev; \
+    l->len--; \
+    if (out != NULL) \
+        *out = node->data; \
+    free(node); \
+    return LLIST_OK; \
+} \
+ \
+/* Clears the given linked list, freeing every node. */ \
+static inline void name##_clear(name##_t *l) { \
+    if (l == NULL) \
+        return; \
+    name##_node_t *current = l->head; \
+    while (current != NULL) { \
+        name##_node_t *n = current; \
+        current = current->next; \
+        free(n); \
+    } \
+    l->head = NULL; \
+    l->tail = NULL; \
+    l->len = 0; \
+}
+
+#endif
+
@@ -0,0 +1,438 @@
+///////////////////////////////////////////////////////////////////////////////
+// pllist.c
+// Persistent linked list implementation in C99 and POSIX. Nodes live in a 
+// memory mapped file and link to each other through file offsets, so an 
+// existing list is opened in O(1) and paged in lazily. 
+//
+// Updates are not crash-consistent between flushes. A crash while elements 
+// are added, inserted or deleted can leave links half updated, so a list 
+// should be flushed after every change that must survive one. Opening a file 
+// only checks that the offsets in its header name nodes inside the file, and 
+// offsets read from nodes are checked as they are followed. 
+//
+// Author: agent
+// Date:   17/10/2026
+///////////////////////////////////////////////////////////////////////////////
+
+#define _POSIX_C_SOURCE 200809L
+#include "pllist.h"
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#define PLLIST_MAGIC "PLLIST1"
+
+static inline pheader_t *pllist_header(const pllist_t *l);
+static inline plnode_t *pnode_at(const pllist_t *l, uint64_t off);
+static int pllist_map(pllist_t *l, size_t cap);
+static bool pllist_valid(const pllist_t *l);
+static bool pnode_valid(const pllist_t *l, uint64_t off);
+static int pnode_new(pllist_t *l, const void *d, size_t n, uint64_t *out);
+static uint64_t pnode_get(const pllist_t *l, size_t i);
+
+// Opens the persistent linked list stored in the given file, creating an 
+// empty one if the file is new or empty. An existing file is rejected unless 
+// its head, tail and free list offsets are 0 or lie between the header and 
+// the end of the allocated space. 
+//
+// PARAMS: 
+// l    - the persistent linked list to open
+// path - the path of the backing file
+//
+// RET: 
+// Zero on success, non-zero on error. 
+int pllist_open(pllist_t *l, const char *path) {
+    if (l == NULL || path == NULL)
+        return LLIST_NULL_ERR;
+
+    l->map = NULL;
+    l->cap = 0;
+    l->fd = open(path, O_RDWR | O_CREAT, 0644);
+    if (l->fd < 0)
+        return LLIST_IO_ERR;
+
+    struct stat st;
+    int ret = (fstat(l->fd, &st) == 0) ? LLIST_OK : LLIST_IO_ERR;
+    if (ret == LLIST_OK && st.st_size == 0) {       // new list
+        ret = pllist_map(l, PLLIST_INIT_CAP);
+        if (ret == LLIST_OK) {
+            pheader_t *h = pllist_header(l);
+            memcpy(h->magic, PLLIST_MAGIC, sizeof h->magic);
+            pllist_clear(l);
+        }
+    } else if (ret == LLIST_OK) {                   // existing list
+        if ((uint64_t)st.st_size < sizeof(pheader_t) || 
+            (uint64_t)st.st_size > SIZE_MAX)
+            ret = LLIST_IO_ERR;
+        if (ret == LLIST_OK)
+            ret = pllist_map(l, (size_t)st.st_size);
+        if (ret == LLIST_OK && !pllist_valid(l))
+            ret = LLIST_IO_ERR;
+    }
+
+    if (ret != LLIST_OK)
+        pllist_close(l);
+    return ret;
+}
+
+// Returns the number of elements in the given persistent linked list. 
+//
+// PARAMS: 
+// l - the persistent linked list to check
+//
+// RET: 
+// The number of elements in the list. 
+size_t pllist_len(const pllist_t *l) {
+    return (l == NULL || l->map == NULL) ? 0 : 
+        (size_t)pllist_header(l)->len;
+}
+
+// Returns the element at the given index in the specified persistent linked 
+// list. If the index is out of range, then the last element will be returned. 
+// The element may move when the file grows. A corrupt link on the way to the 
+// element is reported as an error. 
+//
+// PARAMS: 
+// l - the persistent linked list to retrieve the element
+// i - the index of the element
+//
+// RET: 
+// The element at the given index, or NULL if any error occurred. 
+void *pllist_get(const pllist_t *l, size_t i) {
+    uint64_t node = pnode_get(l, i);
+    void *ret = NULL;
+    if (node != 0)
+        ret = pnode_at(l, node)->data;
+    return ret;
+}
+
+// Add a new element into the given persistent linked list. The element will 
+// be stored as a copy. 
+//
+// PARAMS: 
+// l - the persistent linked list to have the element added
+// d - the element to add
+// n - the size of the element
+//
+// RET: 
+// Zero on success, non-zero on error. 
+int pllist_add(pllist_t *l, const void *d, size_t n) {
+    if (l == NULL || l->map == NULL || d == NULL || n == 0)
+        return LLIST_NULL_ERR;
+
+    uint64_t add = 0;
+    int ret = pnode_new(l, d, n, &add);
+    if (ret != LLIST_OK)
+        return ret;
+
+    pheader_t *h = pllist_header(l);
+    pnode_at(l, add)->prev = h->tail;
+    if (h->len == 0)        // list is empty
+        h->head = add;
+    else
+        pnode_at(l, h->tail)->next = add;
+    h->tail = add;
+    h->len++;
+    return LLIST_OK;
+}
+
+// Inserts a new element into the given persistent linked list. The element 
+// will be stored as a copy. 
+//
+// PARAMS: 
+// l - the persistent linked list to have the element inserted
+// d - the element to insert
+// n - the size of the element
+// i - the index in the persistent linked list to insert to
+//
+// RET: 
+// Zero on success, non-zero on error. 
+int pllist_ins(pllist_t *l, const void *d, size_t n, size_t i) {
+    if (l == NULL || l->map == NULL || d == NULL || n == 0)
+        return LLIST_NULL_ERR;
+    if (i >= pllist_len(l))
+        return pllist_add(l, d, n);     // let pllist_add handle out of range
+
+    uint64_t aft = pnode_get(l, i);     // offsets survive the map moving
+    if (aft == 0)
+        return LLIST_IO_ERR;
+    uint64_t ins = 0;
+    int ret = pnode_new(l, d, n, &ins);
+    if (ret != LLIST_OK)
+        return ret;
+
+    pheader_t *h = pllist_header(l);
+    plnode_t *node = pnode_at(l, ins);
+    plnode_t *aft_node = pnode_at(l, aft);
+    node->prev = aft_node->prev;
+    node->next = aft;
+    if (aft_node->prev == 0)            // insert to head
+        h->head = ins;
+    else                                // insert to mid
+        pnode_at(l, aft_node->prev)->next = ins;
+    aft_node->prev = ins;
+    h->len++;
+    return LLIST_OK;
+}
+
+// Deletes the element at the given index in the specified persistent linked 
+// list. If the given index is out of range, then the last element will be 
+// deleted. Its space is kept for later elements. 
+//
+// PARAMS: 
+// l - the persistent linked list to have the element deleted
+// i - the index of the element
+//
+// RET: 
+// Zero on success, non-zero on error. 
+int pllist_del(pllist_t *l, size_t i) {
+    if (pllist_len(l) == 0)
+        return LLIST_NULL_ERR;
+    uint64_t off = pnode_get(l, i);     // returns last if out of range
+    if (off == 0)
+        return LLIST_IO_ERR;
+
+    pheader_t *h = pllist_header(l);
+    plnode_t *node = pnode_at(l, off);
+    if ((node->prev != 0 && !pnode_valid(l, node->prev)) || 
+        (node->next != 0 && !pnode_valid(l, node->next)))
+        return LLIST_IO_ERR;
+    if (node->prev == 0)
+        h->head = node->next;
+    else
+        pnode_at(l, node->prev)->next = node->next;
+    if (node->next == 0)
+        h->tail = node->prev;
+    else
+        pnode_at(l, node->next)->prev = node->prev;
+    h->len--;
+
+    node->prev = 0;                     // push onto the free list
+    node->next = h->free;
+    node->size = 0;
+    h->free = off;
+    return LLIST_OK;
+}
+
+// Clears the given persistent linked list, releasing the space of every 
+// element. The file keeps its size. 
+//
+// PARAMS: 
+// l - the persistent linked list to clear
+void pllist_clear(pllist_t *l) {
+    if (l != NULL && l->map != NULL) {
+        pheader_t *h = pllist_header(l);
+        h->head = 0;
+        h->tail = 0;
+        h->len = 0;
+        h->used = sizeof *h;
+        h->free = 0;
+    }
+}
+
+// Flushes every change to the given persistent linked list to its file, 
+// returning once the data is durable. Changes since the last flush are not 
+// crash-consistent. 
+//
+// PARAMS: 
+// l - the persistent linked list to flush
+//
+// RET: 
+// Zero on success, non-zero on error. 
+int pllist_flush(pllist_t *l) {
+    if (l == NULL || l->map == NULL)
+        return LLIST_NULL_ERR;
+
+    size_t used = (size_t)pllist_header(l)->used;
+    return (msync(l->map, used, MS_SYNC) == 0) ? LLIST_OK : LLIST_IO_ERR;
+}
+
+// Closes the given persistent linked list. Changes not flushed are written 
+// back by the system at some later point. 
+//
+// PARAMS: 
+// l - the persistent linked list to close
+void pllist_close(pllist_t *l) {
+    if (l != NULL) {
+        if (l->map != NULL)
+            munmap(l->map, l->cap);
+        if (l->fd >= 0)
+            close(l->fd);
+        l->fd = -1;
+        l->map = NULL;
+        l->cap = 0;
+    }
+}
+
+// Returns the header of the given persistent linked list. 
+//
+// PARAMS: 
+// l - the persistent linked list
+//
+// RET: 
+// The header at the start of the mapped file. 
+static inline pheader_t *pllist_header(const pllist_t *l) {
+    return (pheader_t *)l->map;
+}
+
+// Returns the node stored at the given file offset. 
+//
+// PARAMS: 
+// l   - the persistent linked list owning the node
+// off - the offset of the node
+//
+// RET: 
+// The node at the offset. 
+static inline plnode_t *pnode_at(const pllist_t *l, uint64_t off) {
+    return (plnode_t *)(l->map + off);
+}
+
+// Resizes the backing file of the given persistent linked list and maps it 
+// again. Every pointer into the old mapping becomes invalid. 
+//
+// PARAMS: 
+// l   - the persistent linked list to map
+// cap - the new size of the file
+//
+// RET: 
+// Zero on success, non-zero on error. 
+static int pllist_map(pllist_t *l, size_t cap) {
+    if (cap > l->cap && ftruncate(l->fd, (off_t)cap) != 0)
+        return LLIST_IO_ERR;
+
+    void *map = mmap(NULL, cap, PROT_READ | PROT_WRITE, MAP_SHARED, l->fd, 0);
+    if (map == MAP_FAILED)
+        return LLIST_IO_ERR;
+    if (l->map != NULL)
+        munmap(l->map, l->cap);
+    l->map = map;
+    l->cap = cap;
+    return LLIST_OK;
+}
+
+// Returns whether the header of the given persistent linked list is sound: 
+// the magic matches, the allocated space fits the file, and the head, tail 
+// and first free block are 0 or valid nodes, with the head and tail set only 
+// if the list has elements. 
+//
+// PARAMS: 
+// l - the persistent linked list to check
+//
+// RET: 
+// True (1) if the header is sound, 0 (false) otherwise. 
+static bool pllist_valid(const pllist_t *l) {
+    const pheader_t *h = pllist_header(l);
+    if (memcmp(h->magic, PLLIST_MAGIC, sizeof h->magic) != 0 || 
+        h->used < sizeof *h || h->used > l->cap)
+        return false;
+    if ((h->len == 0) != (h->head == 0) || (h->len == 0) != (h->tail == 0))
+        return false;
+    return (h->head == 0 || pnode_valid(l, h->head)) && 
+        (h->tail == 0 || pnode_valid(l, h->tail)) && 
+        (h->free == 0 || pnode_valid(l, h->free));
+}
+
+// Returns whether the given offset names a node of the given persistent 
+// linked list: a 16-byte aligned offset in [sizeof(pheader_t), used), whose 
+// node and data lie within the allocated space. 
+//
+// PARAMS: 
+// l   - the persistent linked list owning the node
+// off - the offset to check
+//
+// RET: 
+// True (1) if the offset names a node, 0 (false) otherwise. 
+static bool pnode_valid(const pllist_t *l, uint64_t off) {
+    uint64_t used = pllist_header(l)->used;
+    if (off < sizeof(pheader_t) || off % 16 != 0 || off >= used || 
+        used - off < sizeof(plnode_t))
+        return false;
+    const plnode_t *node = pnode_at(l, off);
+    return node->cap <= used - off - sizeof(plnode_t) && 
+        node->size <= node->cap;
+}
+
+// Allocates a node in the backing file, reusing a free block if one of the 
+// first PLLIST_FIT_SCAN is large enough, and copies the given element into it. 
+// The file may be grown and mapped again. 
+//
+// PARAMS: 
+// l   - the persistent linked list owning the node
+// d   - the data in the node
+// n   - the size of data
+// out - where to store the offset of the new node
+//
+// RET: 
+// Zero on success, LLIST_IO_ERR if the free list is corrupt, other non-zero 
+// on error. 
+static int pnode_new(pllist_t *l, const void *d, size_t n, uint64_t *out) {
+    pheader_t *h = pllist_header(l);
+    uint64_t ret = 0;
+    uint64_t *link = &h->free;
+    for (int j = 0; *link != 0 && j < PLLIST_FIT_SCAN; j++) {
+        if (!pnode_valid(l, *link))
+            return LLIST_IO_ERR;
+        plnode_t *node = pnode_at(l, *link);
+        if (node->cap >= n) {           // first fit, unlink the block
+            ret = *link;
+            *link = node->next;
+            break;
+        }
+        link = &node->next;
+    }
+
+    if (ret == 0) {                     // bump allocate at the end
+        uint64_t need = (sizeof(plnode_t) + n + 15) & ~(uint64_t)15;
+        if (need > l->cap - h->used) {
+            size_t cap = (l->cap > SIZE_MAX / 2) ? SIZE_MAX : l->cap * 2;
+            if (cap - h->used < need)
+                cap = (size_t)(h->used + need);
+            if (pllist_map(l, cap) != LLIST_OK)
+                return LLIST_ALLOC_ERR;
+            h = pllist_header(l);
+        }
+        ret = h->used;
+        h->used += need;
+        pnode_at(l, ret)->cap = need - sizeof(plnode_t);
+    }
+
+    plnode_t *node = pnode_at(l, ret);
+    node->prev = 0;
+    node->next = 0;
+    node->size = n;
+    memcpy(node->data, d, n);
+    *out = ret;
+    return LLIST_OK;
+}
+
+// Returns the offset of the node at the specified index in the persistent 
+// linked list. If the index is out of range, the last node will be returned. 
+// Every offset followed is checked, so a corrupt link ends the walk. 
+//
+// PARAMS: 
+// l - the persistent linked list to retrieve the node
+// i - the index of the node
+//
+// RET: 
+// The offset of the node retrieved, or 0 if any error occurred. 
+static uint64_t pnode_get(const pllist_t *l, size_t i) {
+    size_t len = pllist_len(l);
+    if (len == 0)
+        return 0;
+
+    const pheader_t *h = pllist_header(l);
+    uint64_t ret = 0;
+    i = (i >= len) ? (len - 1) : i;
+    if (i >= len / 2) {         // node in upper half
+        ret = h->tail;
+        for (size_t j = 0; j < (len - i - 1) && pnode_valid(l, ret); j++)
+            ret = pnode_at(l, ret)->prev;
+    } else {                    // node in lower half
+        ret = h->head;
+        for (size_t j = 0; j < i && pnode_valid(l, ret); j++)
+            ret = pnode_at(l, ret)->next;
+    }
+    return pnode_valid(l, ret) ? ret : 0;
+}
+
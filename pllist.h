@@ -0,0 +1,153 @@
+///////////////////////////////////////////////////////////////////////////////
+// pllist.h
+// Persistent linked list implementation in C99 and POSIX. Nodes live in a 
+// memory mapped file and link to each other through file offsets, so an 
+// existing list is opened in O(1) and paged in lazily. 
+//
+// Updates are not crash-consistent between flushes. A crash while elements 
+// are added, inserted or deleted can leave links half updated, so a list 
+// should be flushed after every change that must survive one. Opening a file 
+// only checks that the offsets in its header name nodes inside the file, and 
+// offsets read from nodes are checked as they are followed. 
+//
+// Author: agent
+// Date:   17/10/2026
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef PLLIST_H
+#define PLLIST_H
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include "llist.h"
+
+#define PLLIST_INIT_CAP 1048576             // initial file size
+#define PLLIST_FIT_SCAN 16                  // free blocks checked per alloc
+
+// The persistent linked list file header, stored at offset 0. An offset of 0 
+// therefore never refers to a node. 
+typedef struct persistent_linked_list_header_t {
+    char magic[8];                          // file magic
+    uint64_t head;                          // offset of list head
+    uint64_t tail;                          // offset of list tail
+    uint64_t len;                           // list size
+    uint64_t used;                          // end of allocated space
+    uint64_t free;                          // offset of first free block
+    uint64_t pad[2];                        // keeps nodes 16-byte aligned
+} pheader_t;
+
+// The persistent linked list node type. 
+typedef struct persistent_linked_list_node_t {
+    uint64_t prev;                          // offset of previous
+    uint64_t next;                          // offset of next
+    uint64_t size;                          // size of internal data
+    uint64_t cap;                           // bytes available for data
+    unsigned char data[];                   // internal data
+} plnode_t;
+
+// The persistent linked list type. 
+typedef struct persistent_linked_list_t {
+    int fd;                                 // backing file descriptor
+    unsigned char *map;                     // mapped file
+    size_t cap;                             // mapped file size
+} pllist_t;
+
+// Opens the persistent linked list stored in the given file, creating an 
+// empty one if the file is new or empty. An existing file is rejected unless 
+// its head, tail and free list offsets are 0 or lie between the header and 
+// the end of the allocated space. 
+//
+// PARAMS: 
+// l    - the persistent linked list to open
+// path - the path of the backing file
+//
+// RET: 
+// Zero on success, non-zero on error. 
+int pllist_open(pllist_t *l, const char *path);
+
+// Returns the number of elements in the given persistent linked list. 
+//
+// PARAMS: 
+// l - the persistent linked list to check
+//
+// RET: 
+// The number of elements in the list. 
+size_t pllist_len(const pllist_t *l);
+
+// Returns the element at the given index in the specified persistent linked 
+// list. If the index is out of range, then the last element will be returned. 
+// The element may move when the file grows. A corrupt link on the way to the 
+// element is reported as an error. 
+//
+// PARAMS: 
+// l - the persistent linked list to retrieve the element
+// i - the index of the element
+//
+// RET: 
+// The element at the given index, or NULL if any error occurred. 
+void *pllist_get(const pllist_t *l, size_t i);
+
+// Add a new element into the given persistent linked list. The element will 
+// be stored as a copy. 
+//
+// PARAMS: 
+// l - the persistent linked list to have the element added
+// d - the element to add
+// n - the size of the element
+//
+// RET: 
+// Zero on success, non-zero on error. 
+int pllist_add(pllist_t *l, const void *d, size_t n);
+
+// Inserts a new element into the given persistent linked list. The element 
+// will be stored as a copy. 
+//
+// PARAMS: 
+// l - the persistent linked list to have the element inserted
+// d - the element to insert
+// n - the size of the element
+// i - the index in the persistent linked list to insert to
+//
+// RET: 
+// Zero on success, non-zero on error. 
+int pllist_ins(pllist_t *l, const void *d, size_t n, size_t i);
+
+// Deletes the element at the given index in the specified persistent linked 
+// list. If the given index is out of range, then the last element will be 
+// deleted. Its space is kept for later elements. 
+//
+// PARAMS: 
+// l - the persistent linked list to have the element deleted
+// i - the index of the element
+//
+// RET: 
+// Zero on success, non-zero on error. 
+int pllist_del(pllist_t *l, size_t i);
+
+// Clears the given persistent linked list, releasing the space of every 
+// element. The file keeps its size. 
+//
+// PARAMS: 
+// l - the persistent linked list to clear
+void pllist_clear(pllist_t *l);
+
+// Flushes every change to the given persistent linked list to its file, 
+// returning once the data is durable. Changes since the last flush are not 
+// crash-consistent. 
+//
+// PARAMS: 
+// l - the persistent linked list to flush
+//
+// RET: 
+// Zero on success, non-zero on error. 
+int pllist_flush(pllist_t *l);
+
+// Closes the given persistent linked list. Changes not flushed are written 
+// back by the system at some later point. 
+//
+// PARAMS: 
+// l - the persistent linked list to close
+void pllist_close(pllist_t *l);
+
+#endif
+
@@ -0,0 +1,237 @@
+///////////////////////////////////////////////////////////////////////////////
+// skllist.c
+// Sorted skip list implementation in C99. Elements are kept in order by a 
+// comparison function, and each node also links forward on a random number 
+// of express levels, so inserting takes O(log n) expected time and the 
+// minimum is always the first node. 
+//
+// Author: agent
+// Date:   17/10/2026
+///////////////////////////////////////////////////////////////////////////////
+
+#include "skllist.h"
+
+static inline void *sknode_data(const sknode_t *n);
+static size_t sknode_level(skllist_t *l);
+static int sknode_link(skllist_t *l, sknode_t **prev[], const void *d, 
+        size_t n);
+static sknode_t **sknode_next(skllist_t *l, sknode_t *n, size_t i);
+
+// Initialises the specified sorted skip list. 
+//
+// PARAMS: 
+// l   - the sorted skip list to initialise
+// cmp - the function ordering the elements
+//
+// RET: 
+// Zero on success, non-zero on error. 
+int skllist_init(skllist_t *l, skllist_cmp_fn cmp) {
+    if (l == NULL || cmp == NULL)
+        return LLIST_NULL_ERR;
+
+    for (size_t i = 0; i < SKLLIST_LEVELS; i++)
+        l->head[i] = NULL;
+    l->level = 1;
+    l->len = 0;
+    l->cmp = cmp;
+    l->seed = 0x9e3779b97f4a7c15ull;
+    return LLIST_OK;
+}
+
+// Inserts a new element into the given sorted skip list, after any equal 
+// elements. The element will be stored as a copy. 
+//
+// PARAMS: 
+// l - the sorted skip list to have the element inserted
+// d - the element to insert
+// n - the size of the element
+//
+// RET: 
+// Zero on success, non-zero on error. 
+int skllist_insert(skllist_t *l, const void *d, size_t n) {
+    if (l == NULL || d == NULL || n == 0)
+        return LLIST_NULL_ERR;
+
+    sknode_t **prev[SKLLIST_LEVELS];        // link to update on each level
+    sknode_t *x = NULL;                     // last node before d, or head
+    for (size_t i = l->level; i-- > 0; ) {
+        sknode_t **link = sknode_next(l, x, i);
+        while (*link != NULL && l->cmp(sknode_data(*link), d) <= 0) {
+            x = *link;
+            link = &x->next[i];
+        }
+        prev[i] = link;
+    }
+    return sknode_link(l, prev, d, n);
+}
+
+// Inserts a copy of every element of the given linked list into the sorted 
+// skip list. The linked list must already be sorted by the same order. Each 
+// search starts from where the previous one ended, so it only covers the gap 
+// between neighbouring elements. 
+//
+// PARAMS: 
+// l   - the sorted skip list to have the elements inserted
+// run - the sorted linked list to merge
+//
+// RET: 
+// Zero on success, non-zero on error. On error, the elements inserted so far 
+// stay in the list. 
+int skllist_merge(skllist_t *l, const llist_t *run) {
+    if (l == NULL || run == NULL)
+        return LLIST_NULL_ERR;
+
+    sknode_t *finger[SKLLIST_LEVELS];       // last node before the previous
+    for (size_t i = 0; i < SKLLIST_LEVELS; i++)
+        finger[i] = NULL;
+
+    int ret = LLIST_OK;
+    for (lnode_t *e = run->head; e != NULL && ret == LLIST_OK; e = e->next) {
+        sknode_t **prev[SKLLIST_LEVELS];
+        sknode_t *x = NULL;
+        for (size_t i = l->level; i-- > 0; ) {
+            sknode_t *f = finger[i];        // resume from the further node
+            if (f != NULL && (x == NULL || 
+                l->cmp(sknode_data(x), sknode_data(f)) < 0))
+                x = f;
+            sknode_t **link = sknode_next(l, x, i);
+            while (*link != NULL && 
+                l->cmp(sknode_data(*link), lnode_data(e)) <= 0) {
+                x = *link;
+                link = &x->next[i];
+            }
+            prev[i] = link;
+            finger[i] = x;
+        }
+        ret = sknode_link(l, prev, lnode_data(e), e->size);
+    }
+    return ret;
+}
+
+// Returns the smallest element in the given sorted skip list. 
+//
+// PARAMS: 
+// l - the sorted skip list to retrieve the element
+//
+// RET: 
+// The smallest element, or NULL if the list is empty. 
+void *skllist_min(const skllist_t *l) {
+    if (l == NULL || l->len == 0)
+        return NULL;
+    return sknode_data(l->head[0]);
+}
+
+// Removes the smallest element in the given sorted skip list. The returned 
+// element should be freed by the caller. 
+//
+// PARAMS: 
+// l - the sorted skip list to have the element removed
+//
+// RET: 
+// The element that just got removed, or NULL if the list is empty. 
+void *skllist_pop_min(skllist_t *l) {
+    if (l == NULL || l->len == 0)
+        return NULL;
+
+    sknode_t *node = l->head[0];            // first on every level it has
+    for (size_t i = 0; i < node->level; i++)
+        l->head[i] = node->next[i];
+    while (l->level > 1 && l->head[l->level - 1] == NULL)
+        l->level--;
+    l->len--;
+    return memmove(node, sknode_data(node), node->size);
+}
+
+// Clears the given sorted skip list, removing and freeing every element. 
+//
+// PARAMS: 
+// l - the sorted skip list to free
+void skllist_clear(skllist_t *l) {
+    if (l != NULL) {
+        sknode_t *current = l->head[0];
+        while (current != NULL) {
+            sknode_t *n = current;
+            current = current->next[0];
+            free(n);
+        }
+        for (size_t i = 0; i < SKLLIST_LEVELS; i++)
+            l->head[i] = NULL;
+        l->level = 1;
+        l->len = 0;
+    }
+}
+
+// Returns the element stored after the links of the given node. 
+//
+// PARAMS: 
+// n - the node holding the element
+//
+// RET: 
+// The element in the node. 
+static inline void *sknode_data(const sknode_t *n) {
+    return (void *)(n->next + n->level);
+}
+
+// Returns a random level for a new node, where each further level is taken 
+// with probability 1/4. 
+//
+// PARAMS: 
+// l - the sorted skip list generating the level
+//
+// RET: 
+// The level, between 1 and SKLLIST_LEVELS. 
+static size_t sknode_level(skllist_t *l) {
+    l->seed ^= l->seed << 13;               // xorshift64
+    l->seed ^= l->seed >> 7;
+    l->seed ^= l->seed << 17;
+    size_t ret = 1;
+    for (uint64_t r = l->seed; (r & 3) == 0 && ret < SKLLIST_LEVELS; r >>= 2)
+        ret++;
+    return ret;
+}
+
+// Returns the link of the given node on a level, or the head link on that 
+// level if the node is NULL. 
+//
+// PARAMS: 
+// l - the sorted skip list owning the node
+// n - the node, or NULL for the head
+// i - the level of the link
+//
+// RET: 
+// The link on the given level. 
+static sknode_t **sknode_next(skllist_t *l, sknode_t *n, size_t i) {
+    return (n != NULL) ? &n->next[i] : &l->head[i];
+}
+
+// Allocates a node holding a copy of the given element, and links it after 
+// the given links on each of its levels. 
+//
+// PARAMS: 
+// l    - the sorted skip list to link the node in
+// prev - the link to update on each level in use
+// d    - the element to copy
+// n    - the size of the element
+//
+// RET: 
+// Zero on success, non-zero on error. 
+static int sknode_link(skllist_t *l, sknode_t **prev[], const void *d, 
+        size_t n) {
+    size_t level = sknode_level(l);
+    sknode_t *node = malloc(sizeof *node + sizeof *node->next * level + n);
+    if (node == NULL)
+        return LLIST_ALLOC_ERR;
+
+    node->size = n;
+    node->level = level;
+    memcpy(sknode_data(node), d, n);
+    for (; l->level < level; l->level++)
+        prev[l->level] = &l->head[l->level];
+    for (size_t i = 0; i < level; i++) {
+        node->next[i] = *prev[i];
+        *prev[i] = node;
+    }
+    l->len++;
+    return LLIST_OK;
+}
+
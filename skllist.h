@@ -0,0 +1,103 @@
+///////////////////////////////////////////////////////////////////////////////
+// skllist.h
+// Sorted skip list implementation in C99. Elements are kept in order by a 
+// comparison function, and each node also links forward on a random number 
+// of express levels, so inserting takes O(log n) expected time and the 
+// minimum is always the first node. 
+//
+// Author: agent
+// Date:   17/10/2026
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef SKLLIST_H
+#define SKLLIST_H
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include "llist.h"
+
+#define SKLLIST_LEVELS 32                   // most levels of a node
+
+// The element comparison type, returning less than, equal to or greater than 
+// zero like the comparison of qsort. 
+typedef int (*skllist_cmp_fn)(const void *a, const void *b);
+
+// The skip list node type. The element follows the links of every level. 
+typedef struct skip_list_node_t {
+    size_t size;                            // size of internal data
+    size_t level;                           // number of links
+    struct skip_list_node_t *next[];        // pointer to next on each level
+} sknode_t;
+
+// The sorted skip list type. 
+typedef struct skip_list_t {
+    sknode_t *head[SKLLIST_LEVELS];         // first node on each level
+    size_t level;                           // levels in use
+    size_t len;                             // list size
+    skllist_cmp_fn cmp;                     // element order
+    uint64_t seed;                          // level generator state
+} skllist_t;
+
+// Initialises the specified sorted skip list. 
+//
+// PARAMS: 
+// l   - the sorted skip list to initialise
+// cmp - the function ordering the elements
+//
+// RET: 
+// Zero on success, non-zero on error. 
+int skllist_init(skllist_t *l, skllist_cmp_fn cmp);
+
+// Inserts a new element into the given sorted skip list, after any equal 
+// elements. The element will be stored as a copy. 
+//
+// PARAMS: 
+// l - the sorted skip list to have the element inserted
+// d - the element to insert
+// n - the size of the element
+//
+// RET: 
+// Zero on success, non-zero on error. 
+int skllist_insert(skllist_t *l, const void *d, size_t n);
+
+// Inserts a copy of every element of the given linked list into the sorted 
+// skip list. The linked list must already be sorted by the same order. Each 
+// search starts from where the previous one ended, so it only covers the gap 
+// between neighbouring elements. 
+//
+// PARAMS: 
+// l   - the sorted skip list to have the elements inserted
+// run - the sorted linked list to merge
+//
+// RET: 
+// Zero on success, non-zero on error. On error, the elements inserted so far 
+// stay in the list. 
+int skllist_merge(skllist_t *l, const llist_t *run);
+
+// Returns the smallest element in the given sorted skip list. 
+//
+// PARAMS: 
+// l - the sorted skip list to retrieve the element
+//
+// RET: 
+// The smallest element, or NULL if the list is empty. 
+void *skllist_min(const skllist_t *l);
+
+// Removes the smallest element in the given sorted skip list. The returned 
+// element should be freed by the caller. 
+//
+// PARAMS: 
+// l - the sorted skip list to have the element removed
+//
+// RET: 
+// The element that just got removed, or NULL if the list is empty. 
+void *skllist_pop_min(skllist_t *l);
+
+// Clears the given sorted skip list, removing and freeing every element. 
+//
+// PARAMS: 
+// l - the sorted skip list to free
+void skllist_clear(skllist_t *l);
+
+#endif
+
@@ -0,0 +1,113 @@
+///////////////////////////////////////////////////////////////////////////////
+// sllist.c
+// Singly linked list implementation in C99, for append-and-scan workloads. 
+// Elements are always stored inline in their node, so each append costs one 
+// allocation and each node carries a single link. 
+//
+// Author: agent
+// Date:   17/10/2026
+///////////////////////////////////////////////////////////////////////////////
+
+#include "sllist.h"
+
+// Initialises the specified singly linked list. 
+//
+// PARAMS: 
+// l - the singly linked list to initialise
+//
+// RET: 
+// Zero on success, non-zero on error. 
+int sllist_init(sllist_t *l) {
+    if (l == NULL)
+        return LLIST_NULL_ERR;
+
+    l->head = NULL;
+    l->tail = NULL;
+    l->len = 0;
+    return LLIST_OK;
+}
+
+// Appends a new element to the tail of the given singly linked list. The 
+// element will be stored as a copy. 
+//
+// PARAMS: 
+// l - the singly linked list to have the element added
+// d - the element to add
+// n - the size of the element
+//
+// RET: 
+// Zero on success, non-zero on error. 
+int sllist_add(sllist_t *l, const void *d, size_t n) {
+    if (l == NULL || d == NULL || n == 0)
+        return LLIST_NULL_ERR;
+
+    slnode_t *add = malloc(sizeof *add + n);
+    if (add == NULL)
+        return LLIST_ALLOC_ERR;
+
+    add->next = NULL;
+    add->size = n;
+    memcpy(add->data, d, n);
+    if (l->len == 0)        // list is empty
+        l->head = add;
+    else
+        l->tail->next = add;
+    l->tail = add;
+    l->len++;
+    return LLIST_OK;
+}
+
+// Removes the node at the head of the given singly linked list in O(1). The 
+// node is handed over whole, with the element in data and its size in size, 
+// and should be freed by the caller. 
+//
+// PARAMS: 
+// l - the singly linked list to have the element removed
+//
+// RET: 
+// The node that just got removed, or NULL if the list is empty. 
+slnode_t *sllist_pop(sllist_t *l) {
+    if (l == NULL || l->len == 0)
+        return NULL;
+
+    slnode_t *node = l->head;
+    l->head = node->next;
+    node->next = NULL;
+    if (--l->len == 0)
+        l->tail = NULL;
+    return node;
+}
+
+// Calls the given function on every element of the given singly linked list, 
+// from head to tail. 
+//
+// PARAMS: 
+// l   - the singly linked list to scan
+// fn  - the function to call with each element, its size and ctx
+// ctx - the context passed to fn
+void sllist_foreach(const sllist_t *l, 
+        void (*fn)(void *d, size_t n, void *ctx), void *ctx) {
+    if (l != NULL && fn != NULL) {
+        for (slnode_t *n = l->head; n != NULL; n = n->next)
+            fn(n->data, n->size, ctx);
+    }
+}
+
+// Clears the given singly linked list, removing and freeing every element. 
+//
+// PARAMS: 
+// l - the singly linked list to free
+void sllist_clear(sllist_t *l) {
+    if (l != NULL) {
+        slnode_t *current = l->head;
+        while (current != NULL) {
+            slnode_t *n = current;
+            current = current->next;
+            free(n);
+        }
+        l->len = 0;
+        l->head = NULL;
+        l->tail = NULL;
+    }
+}
+
@@ -0,0 +1,80 @@
+///////////////////////////////////////////////////////////////////////////////
+// sllist.h
+// Singly linked list implementation in C99, for append-and-scan workloads. 
+// Elements are always stored inline in their node, so each append costs one 
+// allocation and each node carries a single link. 
+//
+// Author: agent
+// Date:   17/10/2026
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef SLLIST_H
+#define SLLIST_H
+#include <stdlib.h>
+#include <string.h>
+#include "llist.h"
+
+// The singly linked list node type. 
+typedef struct singly_linked_list_node_t {
+    struct singly_linked_list_node_t *next; // pointer to next
+    size_t size;                            // size of internal data
+    unsigned char data[];                   // internal data
+} slnode_t;
+
+// The singly linked list type. 
+typedef struct singly_linked_list_t {
+    slnode_t *head;                         // list head
+    slnode_t *tail;                         // list tail
+    size_t len;                             // list size
+} sllist_t;
+
+// Initialises the specified singly linked list. 
+//
+// PARAMS: 
+// l - the singly linked list to initialise
+//
+// RET: 
+// Zero on success, non-zero on error. 
+int sllist_init(sllist_t *l);
+
+// Appends a new element to the tail of the given singly linked list. The 
+// element will be stored as a copy. 
+//
+// PARAMS: 
+// l - the singly linked list to have the element added
+// d - the element to add
+// n - the size of the element
+//
+// RET: 
+// Zero on success, non-zero on error. 
+int sllist_add(sllist_t *l, const void *d, size_t n);
+
+// Removes the node at the head of the given singly linked list in O(1). The 
+// node is handed over whole, with the element in data and its size in size, 
+// and should be freed by the caller. 
+//
+// PARAMS: 
+// l - the singly linked list to have the element removed
+//
+// RET: 
+// The node that just got removed, or NULL if the list is empty. 
+slnode_t *sllist_pop(sllist_t *l);
+
+// Calls the given function on every element of the given singly linked list, 
+// from head to tail. 
+//
+// PARAMS: 
+// l   - the singly linked list to scan
+// fn  - the function to call with each element, its size and ctx
+// ctx - the context passed to fn
+void sllist_foreach(const sllist_t *l, 
+        void (*fn)(void *d, size_t n, void *ctx), void *ctx);
+
+// Clears the given singly linked list, removing and freeing every element. 
+//
+// PARAMS: 
+// l - the singly linked list to free
+void sllist_clear(sllist_t *l);
+
+#endif
+
@@ -0,0 +1,144 @@
+///////////////////////////////////////////////////////////////////////////////
+// spscq.c
+// Single producer single consumer queue implementation in C11. Elements are 
+// linked through nodes, and nodes the consumer is done with are reused by the 
+// producer, so neither side locks, and allocation stops once the queue has 
+// reached its working size. Needs C11 for <stdatomic.h>. 
+//
+// Author: agent
+// Date:   17/10/2026
+///////////////////////////////////////////////////////////////////////////////
+
+#include "spscq.h"
+
+static spscnode_t *qnode_new(spscq_t *q);
+
+// Initialises the specified queue. 
+//
+// PARAMS: 
+// q - the queue to initialise
+//
+// RET: 
+// Zero on success, non-zero on error. 
+int spscq_init(spscq_t *q) {
+    if (q == NULL)
+        return LLIST_NULL_ERR;
+
+    spscnode_t *n = malloc(sizeof *n);
+    if (n == NULL)
+        return LLIST_ALLOC_ERR;
+
+    atomic_init(&n->next, NULL);
+    n->data = NULL;
+    atomic_init(&q->tail, n);
+    q->head = n;
+    q->first = n;
+    q->tail_copy = n;
+    return LLIST_OK;
+}
+
+// Allocates nodes ahead of time, so that the given number of elements can be 
+// queued without allocating. Only the producer may call this. 
+//
+// PARAMS: 
+// q - the queue to reserve nodes in
+// n - the number of nodes to add
+//
+// RET: 
+// Zero on success, non-zero on error. 
+int spscq_reserve(spscq_t *q, size_t n) {
+    if (q == NULL)
+        return LLIST_NULL_ERR;
+
+    for (size_t i = 0; i < n; i++) {        // link in front of the oldest
+        spscnode_t *node = malloc(sizeof *node);
+        if (node == NULL)
+            return LLIST_ALLOC_ERR;
+        node->data = NULL;
+        atomic_init(&node->next, q->first);
+        q->first = node;
+    }
+    return LLIST_OK;
+}
+
+// Adds an element to the back of the given queue. Only the producer may call 
+// this. Wait-free when a consumed node is available for reuse. 
+//
+// PARAMS: 
+// q - the queue to have the element added
+// d - the element to add
+//
+// RET: 
+// Zero on success, non-zero on error. 
+int spscq_push(spscq_t *q, void *d) {
+    spscnode_t *n = qnode_new(q);
+    if (n == NULL)
+        return LLIST_ALLOC_ERR;
+
+    n->data = d;
+    atomic_store_explicit(&n->next, NULL, memory_order_relaxed);
+    atomic_store_explicit(&q->head->next, n, memory_order_release);
+    q->head = n;
+    return LLIST_OK;
+}
+
+// Removes the element at the front of the given queue. Only the consumer may 
+// call this. Always wait-free. 
+//
+// PARAMS: 
+// q   - the queue to have the element removed
+// out - where to store the element
+//
+// RET: 
+// True (1) if an element was removed, 0 (false) if the queue is empty. 
+bool spscq_pop(spscq_t *q, void **out) {
+    spscnode_t *tail = atomic_load_explicit(&q->tail, memory_order_relaxed);
+    spscnode_t *n = atomic_load_explicit(&tail->next, memory_order_acquire);
+    if (n == NULL)
+        return false;
+
+    *out = n->data;
+    atomic_store_explicit(&q->tail, n, memory_order_release);
+    return true;
+}
+
+// Clears the given queue, freeing every node. The elements are not freed. 
+// Neither side may use the queue at the same time. 
+//
+// PARAMS: 
+// q - the queue to free
+void spscq_clear(spscq_t *q) {
+    if (q != NULL) {
+        spscnode_t *current = q->first;     // every node is linked from first
+        while (current != NULL) {
+            spscnode_t *n = current;
+            current = atomic_load_explicit(&n->next, memory_order_relaxed);
+            free(n);
+        }
+        atomic_store_explicit(&q->tail, NULL, memory_order_relaxed);
+        q->head = NULL;
+        q->first = NULL;
+        q->tail_copy = NULL;
+    }
+}
+
+// Returns a node for the producer, reusing one the consumer has moved past if 
+// possible. Nodes before the cached consumer position are reused first, and 
+// the position is only reloaded when they run out. 
+//
+// PARAMS: 
+// q - the queue to take the node from
+//
+// RET: 
+// The node, or NULL if any error occurred. 
+static spscnode_t *qnode_new(spscq_t *q) {
+    if (q->first == q->tail_copy)
+        q->tail_copy = atomic_load_explicit(&q->tail, memory_order_acquire);
+    if (q->first != q->tail_copy) {
+        spscnode_t *n = q->first;
+        q->first = atomic_load_explicit(&n->next, memory_order_relaxed);
+        return n;
+    }
+    return malloc(sizeof(spscnode_t));
+}
+
@@ -0,0 +1,90 @@
+///////////////////////////////////////////////////////////////////////////////
+// spscq.h
+// Single producer single consumer queue implementation in C11. Elements are 
+// linked through nodes, and nodes the consumer is done with are reused by the 
+// producer, so neither side locks, and allocation stops once the queue has 
+// reached its working size. Needs C11 for <stdatomic.h>. 
+//
+// Author: agent
+// Date:   17/10/2026
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef SPSCQ_H
+#define SPSCQ_H
+#include <stdlib.h>
+#include <stdatomic.h>
+#include <stdbool.h>
+#include "llist.h"
+
+#define SPSCQ_LINE 64                       // cache line size
+
+// The queue node type. The queue always holds one consumed node, which the 
+// consumer reads the next element through. 
+typedef struct spsc_queue_node_t {
+    _Atomic(struct spsc_queue_node_t *) next; // pointer to next
+    void *data;                             // element
+} spscnode_t;
+
+// The single producer single consumer queue type. The consumer and producer 
+// fields live on separate cache lines. The producer keeps a copy of the 
+// consumer position, and only reloads it when it runs out of nodes to reuse. 
+typedef struct spsc_queue_t {
+    _Alignas(SPSCQ_LINE)
+    _Atomic(spscnode_t *) tail;             // last consumed node
+    _Alignas(SPSCQ_LINE)
+    spscnode_t *head;                       // last produced node
+    spscnode_t *first;                      // oldest node to reuse
+    spscnode_t *tail_copy;                  // producer copy of tail
+} spscq_t;
+
+// Initialises the specified queue. 
+//
+// PARAMS: 
+// q - the queue to initialise
+//
+// RET: 
+// Zero on success, non-zero on error. 
+int spscq_init(spscq_t *q);
+
+// Allocates nodes ahead of time, so that the given number of elements can be 
+// queued without allocating. Only the producer may call this. 
+//
+// PARAMS: 
+// q - the queue to reserve nodes in
+// n - the number of nodes to add
+//
+// RET: 
+// Zero on success, non-zero on error. 
+int spscq_reserve(spscq_t *q, size_t n);
+
+// Adds an element to the back of the given queue. Only the producer may call 
+// this. Wait-free when a consumed node is available for reuse. 
+//
+// PARAMS: 
+// q - the queue to have the element added
+// d - the element to add
+//
+// RET: 
+// Zero on success, non-zero on error. 
+int spscq_push(spscq_t *q, void *d);
+
+// Removes the element at the front of the given queue. Only the consumer may 
+// call this. Always wait-free. 
+//
+// PARAMS: 
+// q   - the queue to have the element removed
+// out - where to store the element
+//
+// RET: 
+// True (1) if an element was removed, 0 (false) if the queue is empty. 
+bool spscq_pop(spscq_t *q, void **out);
+
+// Clears the given queue, freeing every node. The elements are not freed. 
+// Neither side may use the queue at the same time. 
+//
+// PARAMS: 
+// q - the queue to free
+void spscq_clear(spscq_t *q);
+
+#endif
+
@@ -0,0 +1,52 @@
+///////////////////////////////////////////////////////////////////////////////
+// check.h
+// Check macros shared by the test drivers. Checks stay active under NDEBUG, 
+// and a failed check is reported without stopping the driver, so one run 
+// lists every failure. 
+//
+// Author: agent
+// Date:   17/10/2026
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef CHECK_H
+#define CHECK_H
+#include <stdio.h>
+#include <stdlib.h>
+
+// Records a failed check without stopping the test. 
+#define CHECK(c) check_report((c), #c, __FILE__, __LINE__)
+
+static int check_failures = 0;              // failed checks so far
+
+// Reports the given check if it failed. 
+//
+// PARAMS: 
+// ok   - whether the check passed
+// expr - the checked expression
+// file - the file of the check
+// line - the line of the check
+static inline void check_report(int ok, const char *expr, const char *file, 
+        int line) {
+    if (!ok) {
+        fprintf(stderr, "%s:%d: check failed: %s\n", file, line, expr);
+        check_failures++;
+    }
+}
+
+// Prints the outcome of a test driver. 
+//
+// PARAMS: 
+// name - the name of the driver
+//
+// RET: 
+// The exit status of the driver. 
+static inline int check_done(const char *name) {
+    if (check_failures != 0) {
+        fprintf(stderr, "%s: %d check(s) failed\n", name, check_failures);
+        return EXIT_FAILURE;
+    }
+    printf("%s: all tests passed\n", name);
+    return EXIT_SUCCESS;
+}
+
+#endif
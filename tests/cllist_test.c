@@ -0,0 +1,142 @@
+///////////////////////////////////////////////////////////////////////////////
+// cllist_test.c
+// Tests for cllist_t in C99. 
+//
+// Author: agent
+// Date:   17/10/2026
+///////////////////////////////////////////////////////////////////////////////
+
+#include "cllist.h"
+#include "check.h"
+
+#define TEST_LEN 1000                       // elements in each test list
+
+static bool in_order(const cllist_t *l, size_t first);
+static void test_add_get(void);
+static void test_ins_del(void);
+static void test_align(size_t elem, size_t align);
+static void test_args(void);
+
+int main(void) {
+    test_add_get();
+    test_ins_del();
+    for (size_t elem = 1; elem <= 64; elem++)
+        test_align(elem, 0);
+    test_align(sizeof(long double), 0);
+    test_align(3, 32);
+    test_align(24, 64);
+    test_align(100, 4096);
+    test_args();
+    return check_done("cllist_test");
+}
+
+// Returns whether the size_t elements of a compact list count up from the 
+// given value. 
+//
+// PARAMS: 
+// l     - the compact list to check
+// first - the value of the head element
+//
+// RET: 
+// True (1) if the elements are in order, 0 (false) otherwise. 
+static bool in_order(const cllist_t *l, size_t first) {
+    for (size_t i = 0; i < l->len; i++) {
+        if (*(size_t *)cllist_get(l, i) != first + i)
+            return false;
+    }
+    return true;
+}
+
+// Checks that added elements are copied, kept in order across growth and 
+// found by index from either end. 
+static void test_add_get(void) {
+    cllist_t l;
+    CHECK(cllist_init(&l, sizeof(size_t)) == LLIST_OK);
+    CHECK(cllist_get(&l, 0) == NULL);
+    for (size_t i = 0; i < TEST_LEN; i++)
+        CHECK(cllist_add(&l, &i) == LLIST_OK);
+    CHECK(l.len == TEST_LEN && in_order(&l, 0));
+    CHECK(*(size_t *)cllist_get(&l, SIZE_MAX) == TEST_LEN - 1);
+    cllist_clear(&l);
+    CHECK(l.len == 0 && cllist_get(&l, 0) == NULL);
+    cllist_clear(&l);                       // clearing twice is harmless
+}
+
+// Checks inserting and deleting at the head, middle and tail, and that 
+// deleted nodes are reused before the array grows. 
+static void test_ins_del(void) {
+    cllist_t l;
+    cllist_init(&l, sizeof(size_t));
+    for (size_t i = 1; i < TEST_LEN - 1; i++)
+        cllist_add(&l, &i);
+    size_t v = 0;
+    CHECK(cllist_ins(&l, &v, 0) == LLIST_OK);
+    v = TEST_LEN - 1;
+    CHECK(cllist_ins(&l, &v, SIZE_MAX) == LLIST_OK);
+    CHECK(in_order(&l, 0));
+    v = TEST_LEN;
+    CHECK(cllist_ins(&l, &v, TEST_LEN / 2) == LLIST_OK);
+    CHECK(*(size_t *)cllist_get(&l, TEST_LEN / 2) == TEST_LEN);
+
+    uint32_t cap = l.cap;
+    CHECK(cllist_del(&l, TEST_LEN / 2, &v) == LLIST_OK && v == TEST_LEN);
+    CHECK(cllist_del(&l, 0, &v) == LLIST_OK && v == 0);
+    CHECK(cllist_del(&l, SIZE_MAX, &v) == LLIST_OK && v == TEST_LEN - 1);
+    CHECK(l.len == TEST_LEN - 2 && in_order(&l, 1));
+    for (size_t i = 0; i < 3; i++)
+        CHECK(cllist_add(&l, &i) == LLIST_OK);
+    CHECK(l.cap == cap);                    // free nodes taken first
+
+    while (l.len > 0)
+        CHECK(cllist_del(&l, l.len / 2, NULL) == LLIST_OK);
+    CHECK(l.head == CLLIST_NIL && l.tail == CLLIST_NIL);
+    CHECK(cllist_del(&l, 0, NULL) == LLIST_NULL_ERR);
+    cllist_clear(&l);
+}
+
+// Checks that every element is aligned and intact after the array grows and 
+// moves, for the natural alignment of the element size or a requested one. 
+//
+// PARAMS: 
+// elem  - the size of every element
+// align - the alignment to request, or 0 for the natural one
+static void test_align(size_t elem, size_t align) {
+    cllist_t l;
+    if (align == 0) {
+        CHECK(cllist_init(&l, elem) == LLIST_OK);
+        align = elem & -elem;               // lowest set bit of elem
+        align = (align > LLIST_ARENA_ALIGN) ? LLIST_ARENA_ALIGN : align;
+    } else {
+        CHECK(cllist_init_align(&l, elem, align) == LLIST_OK);
+    }
+
+    unsigned char d[4096];
+    for (size_t i = 0; i < TEST_LEN; i++) {
+        memset(d, (int)(i & 0xff), elem);
+        CHECK(cllist_add(&l, d) == LLIST_OK);
+    }
+    for (size_t i = 0; i < TEST_LEN; i += 7) {
+        unsigned char *e = cllist_get(&l, i);
+        CHECK((uintptr_t)e % align == 0);
+        CHECK(e[0] == (i & 0xff) && e[elem - 1] == (i & 0xff));
+    }
+    cllist_clear(&l);
+}
+
+// Checks that invalid arguments are rejected. 
+static void test_args(void) {
+    cllist_t l;
+    size_t v = 1;
+    CHECK(cllist_init(NULL, 1) == LLIST_NULL_ERR);
+    CHECK(cllist_init(&l, 0) == LLIST_NULL_ERR);
+    CHECK(cllist_init_align(&l, 8, 0) == LLIST_NULL_ERR);
+    CHECK(cllist_init_align(&l, 8, 24) == LLIST_NULL_ERR);
+    cllist_init(&l, sizeof v);
+    CHECK(cllist_add(NULL, &v) == LLIST_NULL_ERR);
+    CHECK(cllist_add(&l, NULL) == LLIST_NULL_ERR);
+    CHECK(cllist_ins(&l, NULL, 0) == LLIST_NULL_ERR);
+    CHECK(cllist_get(NULL, 0) == NULL);
+    CHECK(cllist_del(NULL, 0, NULL) == LLIST_NULL_ERR);
+    CHECK(l.len == 0);
+    cllist_clear(NULL);
+}
@@ -0,0 +1,268 @@
+///////////////////////////////////////////////////////////////////////////////
+// cowllist_test.c
+// Tests for cowllist_t in C11 and POSIX threads. 
+//
+// Author: agent
+// Date:   17/10/2026
+///////////////////////////////////////////////////////////////////////////////
+
+#include "cowllist.h"
+#include "check.h"
+#include <pthread.h>
+
+#define TEST_LEN 1000                       // elements in each test list
+#define TEST_ROUNDS 2000                    // changes made during reads
+
+// The reader type, checking a snapshot from another thread. 
+typedef struct test_reader_t {
+    const cowllist_t *snap;                 // the snapshot to read
+    atomic_bool stop;                       // set once the writer is done
+    size_t bad;                             // elements read wrong
+    size_t passes;                          // full passes over the snapshot
+} treader_t;
+
+static void fill(cowllist_t *l);
+static size_t value(const cowllist_t *l, size_t i);
+static bool counts_up(const cowllist_t *l, size_t len);
+static void *read_snapshot(void *arg);
+static void test_add_get(void);
+static void test_model(void);
+static void test_isolation(void);
+static void test_sharing(void);
+static void test_lifetime(void);
+static void test_concurrent(void);
+
+int main(void) {
+    test_add_get();
+    test_model();
+    test_isolation();
+    test_sharing();
+    test_lifetime();
+    test_concurrent();
+    return check_done("cowllist_test");
+}
+
+// Initialises the given copy-on-write linked list and fills it with TEST_LEN 
+// elements, the element at index i holding i as a size_t. 
+//
+// PARAMS: 
+// l - the copy-on-write linked list to fill
+static void fill(cowllist_t *l) {
+    cowllist_init(l);
+    for (size_t i = 0; i < TEST_LEN; i++)
+        CHECK(cowllist_add(l, &i, sizeof i) == LLIST_OK);
+}
+
+// Returns the size_t stored in the element at the given index. 
+//
+// PARAMS: 
+// l - the copy-on-write linked list to read
+// i - the index of the element
+//
+// RET: 
+// The value of the element, or SIZE_MAX if there is none. 
+static size_t value(const cowllist_t *l, size_t i) {
+    size_t n = 0;
+    const void *d = cowllist_get(l, i, &n);
+    size_t v = SIZE_MAX;
+    if (d != NULL && n == sizeof v)
+        memcpy(&v, d, sizeof v);
+    return v;
+}
+
+// Returns whether a list holds the given number of elements counting up from 
+// zero. 
+//
+// PARAMS: 
+// l   - the copy-on-write linked list to check
+// len - the expected size
+//
+// RET: 
+// True (1) if the elements count up, 0 (false) otherwise. 
+static bool counts_up(const cowllist_t *l, size_t len) {
+    if (cowllist_len(l) != len)
+        return false;
+    for (size_t i = 0; i < len; i++) {
+        if (value(l, i) != i)
+            return false;
+    }
+    return true;
+}
+
+// Reads a snapshot over and over until told to stop, counting elements that 
+// are not where they were when the snapshot was taken. 
+//
+// PARAMS: 
+// arg - the reader
+//
+// RET: 
+// NULL. 
+static void *read_snapshot(void *arg) {
+    treader_t *r = arg;
+    while (!atomic_load(&r->stop) || r->passes == 0) {
+        for (size_t i = 0; i < TEST_LEN; i++)
+            r->bad += (value(r->snap, i) != i);
+        r->passes++;
+    }
+    return NULL;
+}
+
+// Checks adding, inserting, finding and deleting elements, with out of range 
+// indices taking the last element. 
+static void test_add_get(void) {
+    cowllist_t l;
+    fill(&l);
+    CHECK(counts_up(&l, TEST_LEN));
+    CHECK(value(&l, SIZE_MAX) == TEST_LEN - 1);
+
+    size_t v = TEST_LEN;
+    CHECK(cowllist_ins(&l, &v, sizeof v, 0) == LLIST_OK);
+    CHECK(value(&l, 0) == TEST_LEN && value(&l, 1) == 0);
+    CHECK(cowllist_del(&l, 0) == LLIST_OK && counts_up(&l, TEST_LEN));
+    CHECK(cowllist_del(&l, SIZE_MAX) == LLIST_OK);
+    CHECK(counts_up(&l, TEST_LEN - 1));
+
+    while (cowllist_len(&l) > 0)
+        CHECK(cowllist_del(&l, cowllist_len(&l) / 2) == LLIST_OK);
+    CHECK(l.t == NULL && cowllist_get(&l, 0, NULL) == NULL);
+    CHECK(cowllist_del(&l, 0) == LLIST_NULL_ERR);
+    CHECK(cowllist_add(&l, NULL, 1) == LLIST_NULL_ERR);
+    CHECK(cowllist_add(&l, &v, 0) == LLIST_NULL_ERR);
+    cowllist_clear(&l);
+}
+
+// Checks lookups against a plain array after inserts and deletes at spread 
+// out indices, which split and drop segments. 
+static void test_model(void) {
+    size_t model[2 * TEST_LEN];
+    size_t len = 0;
+    cowllist_t l;
+    cowllist_init(&l);
+    for (size_t k = 0; k < 2 * TEST_LEN; k++) {
+        size_t at = (k * 7919) % (len + 1);
+        memmove(model + at + 1, model + at, sizeof *model * (len - at));
+        model[at] = k;
+        len++;
+        CHECK(cowllist_ins(&l, &k, sizeof k, at) == LLIST_OK);
+    }
+    for (size_t k = 0; k < TEST_LEN; k++) {
+        size_t at = (k * 104729) % len;
+        memmove(model + at, model + at + 1, sizeof *model * (len - at - 1));
+        len--;
+        CHECK(cowllist_del(&l, at) == LLIST_OK);
+    }
+
+    CHECK(cowllist_len(&l) == len);
+    for (size_t i = 0; i < len; i++)
+        CHECK(value(&l, i) == model[i]);
+    size_t start = 0;
+    for (size_t s = 0; s < l.t->cnt; s++) {
+        CHECK(l.t->segs[s].start == start && l.t->segs[s].seg->len > 0);
+        start += l.t->segs[s].seg->len;
+    }
+    CHECK(start == len);
+    cowllist_clear(&l);
+}
+
+// Checks that snapshots keep the elements they were taken with while the 
+// live list and other snapshots change. 
+static void test_isolation(void) {
+    cowllist_t live;
+    cowllist_t old;
+    cowllist_t mid;
+    fill(&live);
+    CHECK(cowllist_snapshot(&old, &live) == LLIST_OK);
+
+    size_t v = TEST_LEN;
+    CHECK(cowllist_add(&live, &v, sizeof v) == LLIST_OK);
+    CHECK(cowllist_ins(&live, &v, sizeof v, TEST_LEN / 2) == LLIST_OK);
+    CHECK(cowllist_del(&live, 0) == LLIST_OK);
+    CHECK(cowllist_snapshot(&mid, &live) == LLIST_OK);
+    for (size_t i = 0; i < TEST_LEN / 2; i++)
+        CHECK(cowllist_del(&live, i) == LLIST_OK);
+
+    CHECK(counts_up(&old, TEST_LEN));
+    CHECK(cowllist_len(&mid) == TEST_LEN + 1);
+    CHECK(value(&mid, 0) == 1 && value(&mid, TEST_LEN / 2 - 1) == TEST_LEN);
+    CHECK(value(&mid, TEST_LEN) == TEST_LEN);
+    CHECK(cowllist_len(&live) == TEST_LEN / 2 + 1);
+
+    CHECK(cowllist_del(&old, 0) == LLIST_OK);   // snapshots change alone
+    CHECK(value(&old, 0) == 1 && value(&mid, 0) == 1);
+    CHECK(cowllist_len(&mid) == TEST_LEN + 1);
+    cowllist_clear(&live);
+    CHECK(value(&mid, 0) == 1 && value(&mid, TEST_LEN) == TEST_LEN);
+    cowllist_clear(&mid);
+    cowllist_clear(&old);
+}
+
+// Checks that the first change after a snapshot copies only the segment it 
+// touches, sharing the others with the snapshot. 
+static void test_sharing(void) {
+    cowllist_t live;
+    cowllist_t snap;
+    fill(&live);
+    CHECK(cowllist_snapshot(&snap, &live) == LLIST_OK);
+    CHECK(live.t == snap.t);
+    CHECK(cowllist_del(&live, 1) == LLIST_OK);
+    CHECK(live.t != snap.t && live.t->cnt == snap.t->cnt);
+
+    size_t copied = 0;
+    for (size_t s = 0; s < live.t->cnt; s++)
+        copied += (live.t->segs[s].seg != snap.t->segs[s].seg);
+    CHECK(copied == 1 && live.t->segs[0].seg != snap.t->segs[0].seg);
+    CHECK(cowllist_get(&live, 1, NULL) == cowllist_get(&snap, 2, NULL));
+    cowllist_clear(&snap);
+
+    const cowtable_t *t = live.t;           // unshared now, changed in place
+    CHECK(cowllist_del(&live, 1) == LLIST_OK && live.t == t);
+    cowllist_clear(&live);
+}
+
+// Checks that elements read from a snapshot stay valid after the live list 
+// deletes them and is cleared. 
+static void test_lifetime(void) {
+    cowllist_t live;
+    cowllist_t snap;
+    fill(&live);
+    CHECK(cowllist_snapshot(&snap, &live) == LLIST_OK);
+    const size_t *first = cowllist_get(&snap, 0, NULL);
+    CHECK(cowllist_del(&live, 0) == LLIST_OK);
+    cowllist_clear(&live);
+    CHECK(first != NULL && *first == 0);
+    CHECK(counts_up(&snap, TEST_LEN));
+    cowllist_clear(&snap);
+    CHECK(cowllist_snapshot(&snap, &live) == LLIST_OK && snap.t == NULL);
+    CHECK(cowllist_snapshot(NULL, &live) == LLIST_NULL_ERR);
+}
+
+// Checks that a snapshot read by another thread without locking is unchanged 
+// while the live list is changed and snapshotted again. 
+static void test_concurrent(void) {
+    cowllist_t live;
+    cowllist_t snap;
+    fill(&live);
+    CHECK(cowllist_snapshot(&snap, &live) == LLIST_OK);
+    treader_t r = { .snap = &snap, .bad = 0, .passes = 0 };
+    atomic_init(&r.stop, false);
+    pthread_t tid;
+    CHECK(pthread_create(&tid, NULL, read_snapshot, &r) == 0);
+
+    for (size_t k = 0; k < TEST_ROUNDS; k++) {
+        size_t at = (k * 7919) % (cowllist_len(&live) + 1);
+        CHECK(cowllist_ins(&live, &k, sizeof k, at) == LLIST_OK);
+        CHECK(cowllist_del(&live, (k * 104729) % cowllist_len(&live)) ==
+            LLIST_OK);
+        if (k % 100 == 0) {                 // more snapshots of the live list
+            cowllist_t tmp;
+            CHECK(cowllist_snapshot(&tmp, &live) == LLIST_OK);
+            cowllist_clear(&tmp);
+        }
+    }
+    atomic_store(&r.stop, true);
+    pthread_join(tid, NULL);
+    CHECK(r.bad == 0 && r.passes > 0);
+    CHECK(counts_up(&snap, TEST_LEN) && cowllist_len(&live) == TEST_LEN);
+    cowllist_clear(&snap);
+    cowllist_clear(&live);
+}
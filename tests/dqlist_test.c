@@ -0,0 +1,214 @@
+///////////////////////////////////////////////////////////////////////////////
+// dqlist_test.c
+// Tests for dqlist_t in C99. 
+//
+// Author: agent
+// Date:   17/10/2026
+///////////////////////////////////////////////////////////////////////////////
+
+#include "dqlist.h"
+#include "check.h"
+
+#define TEST_LEN 3000                       // elements in each test list
+#define TEST_BIG (DQLIST_CHUNK + 100)       // element larger than a chunk
+
+static void put(unsigned char *d, size_t elem, size_t v);
+static size_t value(const void *d);
+static bool matches(const dqlist_t *l, const size_t *model, size_t len);
+static void test_ends(size_t elem);
+static void test_middle(size_t elem);
+static void test_fifo(void);
+static void test_bound(void);
+static void test_args(void);
+
+int main(void) {
+    size_t sizes[] = { sizeof(size_t), 24, TEST_BIG };
+    for (size_t k = 0; k < sizeof sizes / sizeof *sizes; k++) {
+        test_ends(sizes[k]);
+        test_middle(sizes[k]);
+    }
+    test_fifo();
+    test_bound();
+    test_args();
+    return check_done("dqlist_test");
+}
+
+// Fills an element with a byte pattern and stores a value at its start. 
+//
+// PARAMS: 
+// d    - the element to fill
+// elem - the size of the element
+// v    - the value to store
+static void put(unsigned char *d, size_t elem, size_t v) {
+    memset(d, (int)(v & 0xff), elem);
+    memcpy(d, &v, sizeof v);
+}
+
+// Returns the size_t stored at the start of an element. 
+//
+// PARAMS: 
+// d - the element
+//
+// RET: 
+// The value of the element. 
+static size_t value(const void *d) {
+    size_t v = 0;
+    memcpy(&v, d, sizeof v);
+    return v;
+}
+
+// Returns whether a deque list holds the values of a plain array in order, 
+// with the last byte of every element longer than a value intact. 
+//
+// PARAMS: 
+// l     - the deque list to check
+// model - the expected values
+// len   - the expected size
+//
+// RET: 
+// True (1) if the list matches, 0 (false) otherwise. 
+static bool matches(const dqlist_t *l, const size_t *model, size_t len) {
+    if (l->len != len)
+        return false;
+    for (size_t i = 0; i < len; i++) {
+        const unsigned char *d = dqlist_get(l, i);
+        if (value(d) != model[i])
+            return false;
+        if (l->elem > sizeof *model && d[l->elem - 1] != (model[i] & 0xff))
+            return false;
+    }
+    return true;
+}
+
+// Checks pushing and popping at both ends against a plain array, growing the 
+// map while the head is inside its chunk. 
+//
+// PARAMS: 
+// elem - the size of every element
+static void test_ends(size_t elem) {
+    static size_t model[2 * TEST_LEN];
+    static unsigned char d[TEST_BIG];
+    size_t first = TEST_LEN;                // model holds [first, last)
+    size_t last = TEST_LEN;
+    dqlist_t l;
+    CHECK(dqlist_init(&l, elem, 0) == LLIST_OK);
+    for (size_t k = 0; k < TEST_LEN; k++) {
+        put(d, elem, k);
+        if (k % 3 == 0) {
+            CHECK(dqlist_ins(&l, d, 0) == LLIST_OK);
+            model[--first] = k;
+        } else {
+            CHECK(dqlist_add(&l, d) == LLIST_OK);
+            model[last++] = k;
+        }
+    }
+    CHECK(matches(&l, model + first, last - first));
+    CHECK(value(dqlist_get(&l, SIZE_MAX)) == model[last - 1]);
+
+    for (size_t k = 0; k < TEST_LEN / 2; k++) {
+        size_t at = (k % 2 == 0) ? 0 : SIZE_MAX;
+        CHECK(dqlist_del(&l, at, d) == LLIST_OK);
+        CHECK(value(d) == ((k % 2 == 0) ? model[first++] : model[--last]));
+    }
+    CHECK(matches(&l, model + first, last - first));
+    while (l.len > 0)
+        CHECK(dqlist_del(&l, 0, NULL) == LLIST_OK);
+    CHECK(dqlist_get(&l, 0) == NULL);
+    put(d, elem, 7);                        // reusable once emptied
+    CHECK(dqlist_add(&l, d) == LLIST_OK && value(dqlist_get(&l, 0)) == 7);
+    dqlist_clear(&l);
+    CHECK(l.map == NULL && l.len == 0);
+}
+
+// Checks inserting and deleting at spread out indices against a plain array, 
+// shifting either half. 
+//
+// PARAMS: 
+// elem - the size of every element
+static void test_middle(size_t elem) {
+    static size_t model[TEST_LEN];
+    static unsigned char d[TEST_BIG];
+    size_t len = 0;
+    dqlist_t l;
+    CHECK(dqlist_init(&l, elem, 0) == LLIST_OK);
+    for (size_t k = 0; k < TEST_LEN; k++) {
+        size_t at = (k * 7919) % (len + 1);
+        put(d, elem, k);
+        CHECK(dqlist_ins(&l, d, at) == LLIST_OK);
+        memmove(model + at + 1, model + at, sizeof *model * (len - at));
+        model[at] = k;
+        len++;
+    }
+    CHECK(matches(&l, model, len));
+    for (size_t k = 0; k < TEST_LEN / 2; k++) {
+        size_t at = (k * 104729) % len;
+        CHECK(dqlist_del(&l, at, d) == LLIST_OK && value(d) == model[at]);
+        memmove(model + at, model + at + 1, sizeof *model * (len - at - 1));
+        len--;
+    }
+    CHECK(matches(&l, model, len));
+    dqlist_clear(&l);
+}
+
+// Checks that a list used as a FIFO keeps its map and chunks once it reaches 
+// its working size. 
+static void test_fifo(void) {
+    dqlist_t l;
+    CHECK(dqlist_init(&l, sizeof(size_t), 0) == LLIST_OK);
+    size_t next = 0;
+    unsigned char **map = NULL;
+    size_t slots = 0;
+    unsigned char *chunks[64] = { NULL };
+    for (size_t k = 0; k < 20 * TEST_LEN; k++) {
+        if (k >= TEST_LEN) {
+            size_t v = 0;
+            CHECK(dqlist_del(&l, 0, &v) == LLIST_OK && v == next++);
+        }
+        CHECK(dqlist_add(&l, &k) == LLIST_OK);
+        if (k == 4 * TEST_LEN) {            // once around the whole ring
+            map = l.map;
+            slots = l.slots;
+            for (size_t s = 0; s < slots && s < 64; s++)
+                chunks[s] = map[s];
+        }
+    }
+    CHECK(l.map == map && l.slots == slots && l.len == TEST_LEN);
+    for (size_t s = 0; s < slots && s < 64; s++)
+        CHECK(l.map[s] == chunks[s]);
+    CHECK(value(dqlist_get(&l, 0)) == next);
+    dqlist_clear(&l);
+}
+
+// Checks that a bounded list refuses elements once full, unchanged, and 
+// takes them again after a delete. 
+static void test_bound(void) {
+    dqlist_t l;
+    CHECK(dqlist_init(&l, sizeof(size_t), 100) == LLIST_OK);
+    for (size_t k = 0; k < 100; k++)
+        CHECK(dqlist_add(&l, &k) == LLIST_OK);
+    size_t v = 100;
+    CHECK(dqlist_add(&l, &v) == LLIST_FULL_ERR);
+    CHECK(dqlist_ins(&l, &v, 0) == LLIST_FULL_ERR);
+    CHECK(dqlist_ins(&l, &v, 50) == LLIST_FULL_ERR);
+    CHECK(l.len == 100 && value(dqlist_get(&l, 0)) == 0);
+    CHECK(dqlist_del(&l, 0, NULL) == LLIST_OK);
+    CHECK(dqlist_ins(&l, &v, 50) == LLIST_OK);
+    CHECK(value(dqlist_get(&l, 49)) == 50 && value(dqlist_get(&l, 50)) == 100);
+    dqlist_clear(&l);
+}
+
+// Checks that missing lists, elements and element sizes are rejected. 
+static void test_args(void) {
+    dqlist_t l;
+    size_t v = 0;
+    CHECK(dqlist_init(NULL, sizeof v, 0) == LLIST_NULL_ERR);
+    CHECK(dqlist_init(&l, 0, 0) == LLIST_NULL_ERR);
+    CHECK(dqlist_init(&l, sizeof v, 0) == LLIST_OK);
+    CHECK(dqlist_add(&l, NULL) == LLIST_NULL_ERR);
+    CHECK(dqlist_add(NULL, &v) == LLIST_NULL_ERR);
+    CHECK(dqlist_ins(&l, NULL, 0) == LLIST_NULL_ERR);
+    CHECK(dqlist_del(&l, 0, &v) == LLIST_NULL_ERR);
+    CHECK(dqlist_get(NULL, 0) == NULL && dqlist_get(&l, 0) == NULL);
+    dqlist_clear(&l);
+    dqlist_clear(NULL);
+}
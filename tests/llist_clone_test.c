@@ -0,0 +1,191 @@
+///////////////////////////////////////////////////////////////////////////////
+// llist_clone_test.c
+// Tests for llist_clone and llist_clone_arena in C99. 
+//
+// Author: agent
+// Date:   17/10/2026
+///////////////////////////////////////////////////////////////////////////////
+
+#include "llist.h"
+#include "check.h"
+
+#define TEST_LEN 1000                       // elements in each test list
+#define TEST_BIG 100                        // size of an out of line element
+
+static void fill(llist_t *l, bool arena);
+static bool same(const llist_t *a, const llist_t *b);
+static bool disjoint(const llist_t *a, const llist_t *b);
+static void test_clone(bool arena);
+static void test_clone_arena(bool arena);
+static void test_empty(void);
+static void test_budget(void);
+static void test_args(void);
+
+int main(void) {
+    test_clone(false);
+    test_clone(true);
+    test_clone_arena(false);
+    test_clone_arena(true);
+    test_empty();
+    test_budget();
+    test_args();
+    return check_done("llist_clone_test");
+}
+
+// Initialises the given linked list and fills it with TEST_LEN elements. The 
+// element at index i starts with i as a size_t, and every third element is 
+// stored out of line. Every tenth element is deleted again, leaving holes. 
+//
+// PARAMS: 
+// l     - the linked list to fill
+// arena - whether to use arena mode
+static void fill(llist_t *l, bool arena) {
+    if (arena)
+        llist_init_arena(l, 4096);
+    else
+        llist_init(l);
+
+    unsigned char d[TEST_BIG];
+    for (size_t i = 0; i < TEST_LEN; i++) {
+        memset(d, (int)(i & 0xff), sizeof d);
+        memcpy(d, &i, sizeof i);
+        size_t n = (i % 3 == 0) ? TEST_BIG : sizeof i + i % 5;
+        CHECK(llist_add(l, d, n) == LLIST_OK);
+    }
+    for (size_t i = 0; i < l->len; i += 9) {
+        void *e = llist_del(l, i);
+        if (!arena)
+            free(e);
+    }
+}
+
+// Returns whether two linked lists hold equal elements in the same order, 
+// and the second is linked consistently. 
+//
+// PARAMS: 
+// a - the first linked list
+// b - the second linked list
+//
+// RET: 
+// True (1) if the lists are equal, 0 (false) otherwise. 
+static bool same(const llist_t *a, const llist_t *b) {
+    if (a->len != b->len || a->bytes != b->bytes)
+        return false;
+    const lnode_t *m = b->head;
+    for (const lnode_t *n = a->head; n != NULL; n = n->next, m = m->next) {
+        if (n->size != m->size || 
+            memcmp(lnode_data(n), lnode_data(m), n->size) != 0)
+            return false;
+        if ((m->prev == NULL) != (m == b->head))
+            return false;
+        if (m->next != NULL && m->next->prev != m)
+            return false;
+    }
+    return b->len == 0 || b->tail->next == NULL;
+}
+
+// Returns whether no node or element of one linked list is shared with the 
+// other. 
+//
+// PARAMS: 
+// a - the first linked list
+// b - the second linked list
+//
+// RET: 
+// True (1) if the lists share nothing, 0 (false) otherwise. 
+static bool disjoint(const llist_t *a, const llist_t *b) {
+    const lnode_t *m = b->head;
+    for (const lnode_t *n = a->head; n != NULL; n = n->next, m = m->next) {
+        if (n == m || lnode_data(n) == lnode_data(m))
+            return false;
+    }
+    return true;
+}
+
+// Checks that a clone is a deep copy in the mode of its source, with heap 
+// elements owned by the copy. 
+//
+// PARAMS: 
+// arena - whether to use arena mode
+static void test_clone(bool arena) {
+    llist_t src;
+    llist_t dst;
+    fill(&src, arena);
+    CHECK(llist_clone(&dst, &src) == LLIST_OK);
+    CHECK(same(&src, &dst) && disjoint(&src, &dst));
+    CHECK((dst.chunk != 0) == arena);
+
+    unsigned char *e = llist_get(&src, 0);
+    e[0] ^= 0xff;                           // the copy does not change
+    CHECK(*(unsigned char *)llist_get(&dst, 0) != e[0]);
+    e[0] ^= 0xff;
+    if (!arena)
+        free(llist_del(&dst, 0));           // heap elements are owned
+    size_t v = 0;
+    CHECK(llist_add(&dst, &v, sizeof v) == LLIST_OK);
+    llist_clear(&dst);
+    CHECK(dst.heap == 0 && dst.len == 0);
+    llist_clear(&src);
+}
+
+// Checks that an arena clone lays nodes out in list order in one chunk, and 
+// grows into normal chunks afterwards. 
+//
+// PARAMS: 
+// arena - whether the source uses arena mode
+static void test_clone_arena(bool arena) {
+    llist_t src;
+    llist_t dst;
+    fill(&src, arena);
+    CHECK(llist_clone_arena(&dst, &src) == LLIST_OK);
+    CHECK(same(&src, &dst) && disjoint(&src, &dst));
+    CHECK(dst.arena != NULL && dst.arena->next == NULL);
+    for (const lnode_t *n = dst.head; n->next != NULL; n = n->next)
+        CHECK((uintptr_t)n < (uintptr_t)n->next);
+
+    unsigned char d[TEST_BIG];
+    memset(d, 0x33, sizeof d);
+    for (size_t i = 0; i < TEST_LEN; i++)
+        CHECK(llist_add(&dst, d, sizeof d) == LLIST_OK);
+    CHECK(dst.arena->next != NULL && dst.len == src.len + TEST_LEN);
+    llist_clear(&dst);
+    llist_clear(&src);
+}
+
+// Checks that empty lists clone to empty lists. 
+static void test_empty(void) {
+    llist_t src;
+    llist_t dst;
+    llist_init(&src);
+    CHECK(llist_clone(&dst, &src) == LLIST_OK && dst.len == 0);
+    CHECK(dst.head == NULL && dst.heap == 0);
+    llist_clear(&dst);
+    CHECK(llist_clone_arena(&dst, &src) == LLIST_OK && dst.len == 0);
+    llist_clear(&dst);
+}
+
+// Checks that a clone over the budget fails and leaves the copy empty. 
+static void test_budget(void) {
+    llist_t src;
+    fill(&src, false);
+    llist_set_budget(src.heap / 2);
+    llist_t dst;
+    CHECK(llist_clone(&dst, &src) == LLIST_BUDGET_ERR);
+    CHECK(dst.len == 0 && dst.head == NULL && dst.heap == 0);
+    CHECK(llist_clone_arena(&dst, &src) == LLIST_BUDGET_ERR);
+    CHECK(dst.len == 0 && dst.heap == 0);
+    CHECK(llist_budget_used() == 0);
+    llist_set_budget(0);
+    llist_clear(&src);
+}
+
+// Checks that missing lists and copies onto the source are rejected. 
+static void test_args(void) {
+    llist_t l;
+    llist_init(&l);
+    CHECK(llist_clone(NULL, &l) == LLIST_NULL_ERR);
+    CHECK(llist_clone(&l, NULL) == LLIST_NULL_ERR);
+    CHECK(llist_clone(&l, &l) == LLIST_NULL_ERR);
+    CHECK(llist_clone_arena(NULL, &l) == LLIST_NULL_ERR);
+    CHECK(llist_clone_arena(&l, &l) == LLIST_NULL_ERR);
+}
@@ -0,0 +1,127 @@
+///////////////////////////////////////////////////////////////////////////////
+// llist_freeze_test.c
+// Tests for llist_freeze and llist_thaw in C99. 
+//
+// Author: agent
+// Date:   17/10/2026
+///////////////////////////////////////////////////////////////////////////////
+
+#include "llist.h"
+#include "check.h"
+
+#define TEST_LEN 1000                       // elements in each test list
+
+static void fill(llist_t *l, bool arena);
+static bool indexed(const llist_t *l);
+static void test_get(bool arena);
+static void test_mutations(void);
+static void test_empty(void);
+
+int main(void) {
+    test_get(false);
+    test_get(true);
+    test_mutations();
+    test_empty();
+    return check_done("llist_freeze_test");
+}
+
+// Initialises the given linked list and fills it with TEST_LEN elements, the 
+// element at index i holding i as a size_t. 
+//
+// PARAMS: 
+// l     - the linked list to fill
+// arena - whether to use arena mode
+static void fill(llist_t *l, bool arena) {
+    if (arena)
+        llist_init_arena(l, 0);
+    else
+        llist_init(l);
+    for (size_t i = 0; i < TEST_LEN; i++)
+        CHECK(llist_add(l, &i, sizeof i) == LLIST_OK);
+}
+
+// Returns whether the given linked list is frozen with an index naming every 
+// node in order. 
+//
+// PARAMS: 
+// l - the linked list to check
+//
+// RET: 
+// True (1) if the index matches the nodes, 0 (false) otherwise. 
+static bool indexed(const llist_t *l) {
+    if (l->index == NULL)
+        return false;
+    size_t i = 0;
+    for (const lnode_t *n = l->head; n != NULL; n = n->next, i++) {
+        if (l->index[i] != n)
+            return false;
+    }
+    return i == l->len;
+}
+
+// Checks that a frozen list indexes every node, finds elements by index, 
+// including out of range ones, and keeps its index when frozen again. 
+//
+// PARAMS: 
+// arena - whether to use arena mode
+static void test_get(bool arena) {
+    llist_t l;
+    fill(&l, arena);
+    CHECK(l.index == NULL);
+    CHECK(llist_freeze(&l) == LLIST_OK && indexed(&l));
+    for (size_t i = 0; i < TEST_LEN; i++)
+        CHECK(*(size_t *)llist_get(&l, i) == i);
+    CHECK(*(size_t *)llist_get(&l, SIZE_MAX) == TEST_LEN - 1);
+
+    lnode_t **index = l.index;
+    CHECK(llist_freeze(&l) == LLIST_OK && l.index == index);
+    llist_thaw(&l);
+    CHECK(l.index == NULL && *(size_t *)llist_get(&l, 7) == 7);
+    llist_thaw(&l);                         // thawing twice is harmless
+    CHECK(l.index == NULL);
+    llist_clear(&l);
+}
+
+// Checks that every change to a frozen list drops its index, and that the 
+// list can be frozen again afterwards. 
+static void test_mutations(void) {
+    llist_t l;
+    fill(&l, false);
+    size_t v = TEST_LEN;
+
+    CHECK(llist_freeze(&l) == LLIST_OK);
+    CHECK(llist_add(&l, &v, sizeof v) == LLIST_OK && l.index == NULL);
+    CHECK(llist_freeze(&l) == LLIST_OK);
+    CHECK(llist_ins(&l, &v, sizeof v, 3) == LLIST_OK && l.index == NULL);
+    CHECK(llist_freeze(&l) == LLIST_OK);
+    free(llist_del(&l, 3));
+    CHECK(l.index == NULL);
+    CHECK(llist_freeze(&l) == LLIST_OK);
+    CHECK(llist_reverse(&l) == LLIST_OK && l.index == NULL);
+    CHECK(llist_freeze(&l) == LLIST_OK && indexed(&l));
+    CHECK(*(size_t *)llist_get(&l, 0) == TEST_LEN);
+    CHECK(llist_rotate(&l, 1) == LLIST_OK && l.index == NULL);
+    CHECK(llist_freeze(&l) == LLIST_OK && indexed(&l));
+    CHECK(*(size_t *)llist_get(&l, 0) == TEST_LEN - 1);
+
+    llist_t out;
+    CHECK(llist_split(&l, TEST_LEN / 2, &out) == LLIST_OK);
+    CHECK(l.index == NULL && out.index == NULL);
+    CHECK(llist_freeze(&l) == LLIST_OK && indexed(&l));
+    CHECK(llist_freeze(&out) == LLIST_OK && indexed(&out));
+    llist_clear(&out);
+    CHECK(out.index == NULL);
+    llist_clear(&l);
+    CHECK(l.index == NULL);
+}
+
+// Checks that freezing an empty list succeeds without an index. 
+static void test_empty(void) {
+    llist_t l;
+    llist_init(&l);
+    CHECK(llist_freeze(&l) == LLIST_OK && l.index == NULL);
+    CHECK(llist_get(&l, 0) == NULL);
+    CHECK(llist_freeze(NULL) == LLIST_NULL_ERR);
+    llist_thaw(NULL);
+    llist_clear(&l);
+}
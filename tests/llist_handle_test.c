@@ -0,0 +1,244 @@
+///////////////////////////////////////////////////////////////////////////////
+// llist_handle_test.c
+// Tests for linked list handles in C99. 
+//
+// Author: agent
+// Date:   17/10/2026
+///////////////////////////////////////////////////////////////////////////////
+
+#include "llist.h"
+#include "check.h"
+
+#define TEST_LEN 1000                       // elements in each test list
+#define TEST_BIG 100                        // size of an out of line element
+
+static size_t value(const void *d);
+static bool matches(const llist_t *l, const size_t *model, size_t len);
+static void test_handles(void);
+static void test_move(bool arena);
+static void test_sizes(bool arena);
+static void test_stale(void);
+static void test_args(void);
+
+int main(void) {
+    test_handles();
+    test_move(false);
+    test_move(true);
+    test_sizes(false);
+    test_sizes(true);
+    test_stale();
+    test_args();
+    return check_done("llist_handle_test");
+}
+
+// Returns the size_t stored at the start of an element. 
+//
+// PARAMS: 
+// d - the element
+//
+// RET: 
+// The value of the element. 
+static size_t value(const void *d) {
+    size_t v = 0;
+    memcpy(&v, d, sizeof v);
+    return v;
+}
+
+// Returns whether a linked list holds the values of a plain array in order, 
+// and is linked consistently. 
+//
+// PARAMS: 
+// l     - the linked list to check
+// model - the expected values
+// len   - the expected size
+//
+// RET: 
+// True (1) if the list matches, 0 (false) otherwise. 
+static bool matches(const llist_t *l, const size_t *model, size_t len) {
+    size_t i = 0;
+    for (const lnode_t *n = l->head; n != NULL; n = n->next, i++) {
+        if (i >= len || value(lnode_data(n)) != model[i])
+            return false;
+        if ((n->prev == NULL) != (n == l->head))
+            return false;
+        if (n->next != NULL && n->next->prev != n)
+            return false;
+    }
+    return i == len && l->len == len && (len == 0 || l->tail->next == NULL);
+}
+
+// Checks finding, deleting and moving elements by handle, slot reuse under a 
+// new generation, and that split and clear stale the handles they drop. 
+static void test_handles(void) {
+    llist_t l;
+    llist_t o;
+    llist_handle_t h[TEST_LEN];
+    llist_init(&l);
+    for (size_t i = 0; i < TEST_LEN; i++)
+        CHECK(llist_add_handle(&l, &i, sizeof i, &h[i]) == LLIST_OK);
+    CHECK(value(llist_get_handle(&l, h[10])) == 10);
+
+    free(llist_del_handle(&l, h[10]));
+    CHECK(llist_get_handle(&l, h[10]) == NULL);
+    CHECK(llist_del_handle(&l, h[10]) == NULL);
+    CHECK(llist_move_before(&l, h[10], h[0]) == LLIST_HANDLE_ERR);
+
+    size_t v = TEST_LEN;
+    llist_handle_t reused;                  // takes the freed slot
+    CHECK(llist_ins_handle(&l, &v, sizeof v, 0, &reused) == LLIST_OK);
+    CHECK(reused.slot == h[10].slot && reused.gen != h[10].gen);
+    CHECK(llist_get_handle(&l, h[10]) == NULL);
+    CHECK(value(llist_get_handle(&l, reused)) == TEST_LEN);
+
+    llist_handle_t tail = { 0, 0 };
+    CHECK(llist_move_before(&l, reused, tail) == LLIST_OK);
+    CHECK(value(llist_get(&l, l.len - 1)) == TEST_LEN);
+    CHECK(llist_move_before(&l, h[0], h[5]) == LLIST_OK);
+    CHECK(value(llist_get(&l, 4)) == 0);
+    CHECK(value(llist_get_handle(&l, h[0])) == 0);
+
+    CHECK(llist_split(&l, TEST_LEN / 2, &o) == LLIST_OK);
+    size_t live = 0;
+    for (size_t i = 0; i < TEST_LEN; i++) {
+        CHECK(llist_get_handle(&o, h[i]) == NULL);
+        live += (llist_get_handle(&l, h[i]) != NULL);
+    }
+    CHECK(live == TEST_LEN / 2);
+    llist_clear(&o);
+
+    llist_handle_t kept = h[1];
+    llist_clear(&l);
+    CHECK(l.heap == 0);
+    CHECK(llist_get_handle(&l, kept) == NULL);
+    CHECK(llist_add_handle(&l, &v, sizeof v, &h[0]) == LLIST_OK);
+    CHECK(llist_get_handle(&l, kept) == NULL);
+    llist_clear(&l);
+}
+
+// Checks many moves to the front, the tail and around the list against a 
+// plain array, with element addresses kept. 
+//
+// PARAMS: 
+// arena - whether to use arena mode
+static void test_move(bool arena) {
+    size_t model[TEST_LEN];
+    llist_handle_t h[TEST_LEN];
+    llist_t l;
+    if (arena)
+        llist_init_arena(&l, 0);
+    else
+        llist_init(&l);
+    for (size_t i = 0; i < TEST_LEN; i++) {
+        CHECK(llist_add_handle(&l, &i, sizeof i, &h[i]) == LLIST_OK);
+        model[i] = i;
+    }
+    const void *first = llist_get_handle(&l, h[0]);
+
+    llist_handle_t tail = { 0, 0 };
+    for (size_t k = 0; k < TEST_LEN; k++) {
+        size_t a = (k * 7919) % TEST_LEN;   // move value a before value b
+        size_t b = (k * 104729 + 1) % (TEST_LEN + 1);
+        llist_handle_t pos = (b == TEST_LEN) ? tail : h[b];
+        CHECK(llist_move_before(&l, h[a], pos) == LLIST_OK);
+
+        size_t from = 0;
+        while (model[from] != a)
+            from++;
+        memmove(model + from, model + from + 1, 
+            sizeof *model * (TEST_LEN - from - 1));
+        size_t to = TEST_LEN - 1;
+        if (b != TEST_LEN && b != a) {
+            to = 0;
+            while (model[to] != b)
+                to++;
+        } else if (b == a) {
+            to = from;
+        }
+        memmove(model + to + 1, model + to, 
+            sizeof *model * (TEST_LEN - to - 1));
+        model[to] = a;
+    }
+    CHECK(matches(&l, model, TEST_LEN));
+    CHECK(llist_get_handle(&l, h[0]) == first);
+    for (size_t i = 0; i < TEST_LEN; i++)
+        CHECK(value(llist_get_handle(&l, h[i])) == i);
+    llist_clear(&l);
+}
+
+// Checks handles to tiny, inline and out of line elements, whose nodes keep 
+// their slots in different places. 
+//
+// PARAMS: 
+// arena - whether to use arena mode
+static void test_sizes(bool arena) {
+    llist_t l;
+    if (arena)
+        llist_init_arena(&l, 0);
+    else
+        llist_init(&l);
+    unsigned char d[TEST_BIG];
+    llist_handle_t h[TEST_BIG];
+    for (size_t n = 1; n <= TEST_BIG; n++) {
+        memset(d, (int)n, n);
+        CHECK(llist_add_handle(&l, d, n, &h[n - 1]) == LLIST_OK);
+    }
+    for (size_t n = 1; n <= TEST_BIG; n++) {
+        const unsigned char *e = llist_get_handle(&l, h[n - 1]);
+        CHECK(e != NULL && e[0] == n && e[n - 1] == n);
+    }
+    for (size_t n = 1; n <= TEST_BIG; n += 2) {
+        unsigned char *e = llist_del_handle(&l, h[n - 1]);
+        CHECK(e != NULL && e[n - 1] == n);
+        if (!arena)
+            free(e);
+    }
+    for (size_t n = 2; n <= TEST_BIG; n += 2)
+        CHECK(*(unsigned char *)llist_get_handle(&l, h[n - 1]) == n);
+    CHECK(l.len == TEST_BIG / 2);
+    llist_clear(&l);
+}
+
+// Checks that deleting by index stales the handle of the deleted element 
+// only, and that stale or forged handles are rejected. 
+static void test_stale(void) {
+    llist_t l;
+    llist_handle_t h[TEST_LEN];
+    llist_init(&l);
+    for (size_t i = 0; i < TEST_LEN; i++)
+        CHECK(llist_add_handle(&l, &i, sizeof i, &h[i]) == LLIST_OK);
+    size_t v = 0;
+    CHECK(llist_add(&l, &v, sizeof v) == LLIST_OK);     // no handle
+    free(llist_del(&l, 3));
+    CHECK(llist_get_handle(&l, h[3]) == NULL);
+    CHECK(value(llist_get_handle(&l, h[4])) == 4);
+    free(llist_del(&l, SIZE_MAX));
+    CHECK(value(llist_get_handle(&l, h[TEST_LEN - 1])) == TEST_LEN - 1);
+
+    CHECK(llist_move_before(&l, h[3], h[0]) == LLIST_HANDLE_ERR);
+    CHECK(llist_move_before(&l, h[0], h[3]) == LLIST_HANDLE_ERR);
+    CHECK(value(llist_get(&l, 0)) == 0 && l.len == TEST_LEN - 1);
+    llist_handle_t forged = { h[0].slot, h[0].gen + 1 };
+    CHECK(llist_get_handle(&l, forged) == NULL);
+    forged.slot = TEST_LEN + 1;
+    CHECK(llist_get_handle(&l, forged) == NULL);
+    CHECK(llist_del_handle(&l, forged) == NULL && l.len == TEST_LEN - 1);
+    llist_clear(&l);
+}
+
+// Checks that missing lists, elements and handles are rejected. 
+static void test_args(void) {
+    llist_t l;
+    llist_handle_t h = { 0, 0 };
+    size_t v = 0;
+    llist_init(&l);
+    CHECK(llist_add_handle(NULL, &v, sizeof v, &h) != LLIST_OK);
+    CHECK(llist_add_handle(&l, NULL, sizeof v, &h) != LLIST_OK);
+    CHECK(llist_add_handle(&l, &v, sizeof v, NULL) != LLIST_OK);
+    CHECK(llist_ins_handle(&l, &v, sizeof v, 0, NULL) != LLIST_OK);
+    CHECK(l.len == 0);
+    CHECK(llist_get_handle(&l, h) == NULL && llist_del_handle(&l, h) == NULL);
+    CHECK(llist_move_before(&l, h, h) == LLIST_NULL_ERR);
+    CHECK(llist_move_before(NULL, h, h) == LLIST_NULL_ERR);
+    CHECK(llist_get_handle(NULL, h) == NULL);
+    llist_clear(&l);
+}
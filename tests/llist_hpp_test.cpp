@@ -0,0 +1,149 @@
+///////////////////////////////////////////////////////////////////////////////
+// llist_hpp_test.cpp
+// Tests for ll::llist in C++17.
+//
+// Author: agent
+// Date:   17/10/2026
+///////////////////////////////////////////////////////////////////////////////
+
+#include "llist.hpp"
+#include "check.h"
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <string>
+
+// An element counting its live copies, whose copies throw once armed.
+struct counted {
+    static inline int live = 0;             // constructed, not destroyed
+    static inline int copies_left = -1;     // copies before one throws
+    int v;
+
+    explicit counted(int v) : v(v) { live++; }
+    counted(const counted &other) : v(other.v) {
+        if (copies_left == 0)
+            throw std::runtime_error("copy");
+        if (copies_left > 0)
+            copies_left--;
+        live++;
+    }
+    ~counted() { live--; }
+};
+
+static void test_basic();
+static void test_move_only();
+static void test_copy_throw();
+static void test_pmr();
+
+int main() {
+    test_basic();
+    test_move_only();
+    test_copy_throw();
+    test_pmr();
+    return check_done("llist_hpp_test");
+}
+
+// Checks inserting and erasing at either end and the middle, iterating both
+// ways, and copies, moves and swaps.
+static void test_basic() {
+    ll::llist<int> l;
+    CHECK(l.empty() && l.begin() == l.end());
+    for (int i = 1; i < 9; i++)
+        l.push_back(i);
+    l.push_front(0);
+    l.emplace_back(9);
+    auto mid = std::next(l.begin(), 5);
+    mid = l.insert(mid, -5);
+    CHECK(*mid == -5 && l.size() == 11);
+    mid = l.erase(mid);
+    CHECK(*mid == 5 && l.size() == 10);
+
+    int i = 0;
+    for (int d : l)
+        CHECK(d == i++);
+    for (auto it = l.rbegin(); it != l.rend(); ++it)
+        CHECK(*it == --i);
+    CHECK(l.front() == 0 && l.back() == 9);
+
+    ll::llist<int> copy(l);
+    l.pop_front();
+    l.pop_back();
+    CHECK(copy.size() == 10 && l.size() == 8 && copy.front() == 0);
+    ll::llist<int> moved(std::move(copy));
+    CHECK(copy.empty() && moved.size() == 10);
+    swap(l, moved);
+    CHECK(l.size() == 10 && moved.size() == 8 && moved.front() == 1);
+    CHECK(*--l.end() == 9 && *std::prev(moved.end()) == 8);
+    l.erase(std::next(l.begin()), std::prev(l.end()));
+    CHECK(l.size() == 2 && l.front() == 0 && l.back() == 9);
+    l = moved;
+    CHECK(l.size() == 8 && l.front() == 1);
+    l.clear();
+    CHECK(l.empty() && l.begin() == l.end());
+}
+
+// Checks that move-only elements are constructed in place and moved.
+static void test_move_only() {
+    ll::llist<std::unique_ptr<int>> l;
+    l.push_back(std::make_unique<int>(1));
+    l.emplace_front(new int(0));
+    CHECK(*l.front() == 0 && *l.back() == 1);
+    ll::llist<std::unique_ptr<int>> other;
+    other = std::move(l);
+    CHECK(l.empty() && other.size() == 2 && *other.back() == 1);
+}
+
+// Checks that a copy which throws part way leaves both lists unchanged and
+// destroys the elements copied so far.
+static void test_copy_throw() {
+    {
+        ll::llist<counted> a;
+        ll::llist<counted> b;
+        for (int i = 0; i < 5; i++) {
+            a.emplace_back(i);
+            b.emplace_back(-i);
+        }
+        counted::copies_left = 3;
+        bool threw = false;
+        try {
+            b = a;
+        } catch (const std::runtime_error &) {
+            threw = true;
+        }
+        counted::copies_left = -1;
+        CHECK(threw && counted::live == 10);
+        CHECK(b.size() == 5 && b.back().v == -4 && a.back().v == 4);
+
+        counted::copies_left = 0;
+        threw = false;
+        try {
+            ll::llist<counted> c(a);
+        } catch (const std::runtime_error &) {
+            threw = true;
+        }
+        counted::copies_left = -1;
+        CHECK(threw && counted::live == 10);
+    }
+    CHECK(counted::live == 0);
+}
+
+// Checks that pmr lists take nodes from their resource, and that moving
+// between resources moves the elements rather than the nodes.
+static void test_pmr() {
+    unsigned char buf[4096];
+    std::pmr::monotonic_buffer_resource res(buf, sizeof buf,
+        std::pmr::null_memory_resource());
+    std::pmr::unsynchronized_pool_resource other;
+    ll::pmr::llist<std::string> a(&res);
+    for (int i = 0; i < 10; i++)
+        a.push_back(std::to_string(i));
+    CHECK(a.get_allocator().resource() == &res);
+
+    ll::pmr::llist<std::string> b(&other);
+    b = std::move(a);                       // resources differ
+    CHECK(b.size() == 10 && b.back() == "9" && a.empty());
+    CHECK(b.get_allocator().resource() == &other);
+    ll::pmr::llist<std::string> c(b);       // copies keep the default
+    CHECK(c.size() == 10 && c.front() == "0");
+    CHECK(c.get_allocator().resource() == std::pmr::get_default_resource());
+}
@@ -0,0 +1,117 @@
+///////////////////////////////////////////////////////////////////////////////
+// llist_intrusive_test.c
+// Tests for the intrusive linked lists of llist_intrusive.h in C99. 
+//
+// Author: agent
+// Date:   17/10/2026
+///////////////////////////////////////////////////////////////////////////////
+
+#include "llist_intrusive.h"
+#include "check.h"
+
+#define TEST_LEN 10                         // objects in each test list
+
+// An object linked through an embedded link. 
+typedef struct job_t {
+    int id;                                 // the object value
+    llist_link_t link;                      // the embedded link
+} job_t;
+
+static bool ids_are(llist_link_t *h, const int *want, size_t n);
+static void unlink_odd(llist_link_t *n, void *ctx);
+static void test_link(void);
+static void test_foreach(void);
+
+int main(void) {
+    test_link();
+    test_foreach();
+    return check_done("llist_intrusive_test");
+}
+
+// Returns whether walking an intrusive list forwards gives the wanted ids, 
+// and walking it backwards gives them reversed. 
+//
+// PARAMS: 
+// h    - the sentinel link of the list
+// want - the ids expected from the head
+// n    - the number of ids
+//
+// RET: 
+// True (1) if both walks match, 0 (false) otherwise. 
+static bool ids_are(llist_link_t *h, const int *want, size_t n) {
+    size_t i = 0;
+    for (llist_link_t *p = h->next; p != h; p = p->next, i++) {
+        if (i >= n || LLIST_CONTAINER_OF(p, job_t, link)->id != want[i])
+            return false;
+    }
+    if (i != n)
+        return false;
+    for (llist_link_t *p = h->prev; p != h; p = p->prev) {
+        if (LLIST_CONTAINER_OF(p, job_t, link)->id != want[--i])
+            return false;
+    }
+    return true;
+}
+
+// Unlinks the object of the given link if its id is odd, counting the 
+// objects visited. 
+//
+// PARAMS: 
+// n   - the link of the object
+// ctx - the count of visited objects, an int
+static void unlink_odd(llist_link_t *n, void *ctx) {
+    (*(int *)ctx)++;
+    if (LLIST_CONTAINER_OF(n, job_t, link)->id % 2 != 0)
+        llist_intrusive_unlink(n);
+}
+
+// Checks linking at the head, middle and tail, unlinking, and that unlinked 
+// links read as being in no list. 
+static void test_link(void) {
+    job_t jobs[TEST_LEN];
+    llist_link_t h;
+    llist_intrusive_init(&h);
+    CHECK(llist_intrusive_empty(&h) && ids_are(&h, NULL, 0));
+    for (int i = 0; i < TEST_LEN; i++) {
+        jobs[i].id = i;
+        llist_intrusive_init(&jobs[i].link);
+    }
+
+    llist_intrusive_push_back(&h, &jobs[1].link);
+    llist_intrusive_push_back(&h, &jobs[3].link);
+    llist_intrusive_insert_after(&h, &jobs[0].link);            // head
+    llist_intrusive_insert_after(&jobs[1].link, &jobs[2].link); // middle
+    llist_intrusive_insert_after(h.prev, &jobs[4].link);        // tail
+    CHECK(!llist_intrusive_empty(&h));
+    CHECK(ids_are(&h, (int[]){ 0, 1, 2, 3, 4 }, 5));
+
+    llist_intrusive_unlink(&jobs[2].link);
+    CHECK(llist_intrusive_empty(&jobs[2].link));
+    llist_intrusive_unlink(&jobs[2].link);  // unlinking twice is harmless
+    llist_intrusive_unlink(&jobs[0].link);
+    llist_intrusive_unlink(&jobs[4].link);
+    CHECK(ids_are(&h, (int[]){ 1, 3 }, 2));
+    llist_intrusive_unlink(&jobs[1].link);
+    llist_intrusive_unlink(&jobs[3].link);
+    CHECK(llist_intrusive_empty(&h) && ids_are(&h, NULL, 0));
+}
+
+// Checks that foreach visits every link in order, and allows the visited 
+// link to be unlinked. 
+static void test_foreach(void) {
+    job_t jobs[TEST_LEN];
+    llist_link_t h;
+    llist_intrusive_init(&h);
+    for (int i = 0; i < TEST_LEN; i++) {
+        jobs[i].id = i;
+        llist_intrusive_push_back(&h, &jobs[i].link);
+    }
+    int seen = 0;
+    llist_intrusive_foreach(&h, unlink_odd, &seen);
+    CHECK(seen == TEST_LEN);
+    CHECK(ids_are(&h, (int[]){ 0, 2, 4, 6, 8 }, 5));
+    CHECK(llist_intrusive_empty(&jobs[1].link));
+    seen = 0;
+    llist_intrusive_foreach(&h, unlink_odd, &seen);
+    CHECK(seen == TEST_LEN / 2);
+}
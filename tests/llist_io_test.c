@@ -0,0 +1,158 @@
+///////////////////////////////////////////////////////////////////////////////
+// llist_io_test.c
+// Tests for llist_save and llist_load in C99 and POSIX. 
+//
+// Author: agent
+// Date:   17/10/2026
+///////////////////////////////////////////////////////////////////////////////
+
+#define _POSIX_C_SOURCE 200809L
+#include "llist.h"
+#include "check.h"
+#include <stdio.h>
+#include <unistd.h>
+
+#define TEST_LEN 300                        // elements in each test list
+#define TEST_HUGE 200000                    // larger than the read buffer
+
+static void fill(llist_t *l, bool arena);
+static bool same(const llist_t *a, const llist_t *b);
+static void test_round_trip(bool arena);
+static void test_truncated(bool arena);
+static void test_bad_magic(void);
+
+int main(void) {
+    for (int arena = 0; arena < 2; arena++) {
+        test_round_trip(arena);
+        test_truncated(arena);
+    }
+    test_bad_magic();
+    return check_done("llist_io_test");
+}
+
+// Initialises the given linked list and fills it with TEST_LEN elements of 
+// growing sizes, from inline ones to ones larger than the read buffer. The 
+// last element is the largest. 
+//
+// PARAMS: 
+// l     - the linked list to fill
+// arena - whether to use arena mode
+static void fill(llist_t *l, bool arena) {
+    if (arena)
+        llist_init_arena(l, 0);
+    else
+        llist_init(l);
+
+    unsigned char *d = malloc(TEST_HUGE);
+    CHECK(d != NULL);
+    for (size_t i = 0; d != NULL && i < TEST_LEN; i++) {
+        size_t n = (i == TEST_LEN - 1) ? TEST_HUGE : 
+            (i % 10 == 0) ? 600 + i : i % 20 + 1;
+        for (size_t j = 0; j < n; j++)
+            d[j] = (unsigned char)(i + j);
+        CHECK(llist_add(l, d, n) == LLIST_OK);
+    }
+    free(d);
+}
+
+// Returns whether two linked lists hold equal elements in the same order. 
+//
+// PARAMS: 
+// a - the first linked list
+// b - the second linked list
+//
+// RET: 
+// True (1) if the lists are equal, 0 (false) otherwise. 
+static bool same(const llist_t *a, const llist_t *b) {
+    if (a->len != b->len || a->bytes != b->bytes)
+        return false;
+    const lnode_t *m = b->head;
+    for (const lnode_t *n = a->head; n != NULL; n = n->next, m = m->next) {
+        if (n->size != m->size || 
+            memcmp(lnode_data(n), lnode_data(m), n->size) != 0)
+            return false;
+    }
+    return true;
+}
+
+// Checks that a saved list loads back equal, and loads appended to the 
+// elements a list already has. 
+//
+// PARAMS: 
+// arena - whether to use arena mode
+static void test_round_trip(bool arena) {
+    llist_t l;
+    llist_t back;
+    fill(&l, arena);
+    FILE *f = tmpfile();
+    CHECK(f != NULL);
+    if (f == NULL)
+        return;
+
+    CHECK(llist_save(&l, fileno(f)) == LLIST_OK);
+    CHECK(lseek(fileno(f), 0, SEEK_SET) == 0);
+    if (arena)
+        llist_init_arena(&back, 0);
+    else
+        llist_init(&back);
+    CHECK(llist_load(&back, fileno(f)) == LLIST_OK);
+    CHECK(same(&l, &back));
+    CHECK(llist_load(&back, fileno(f)) == LLIST_IO_ERR);  // at end of file
+    CHECK(same(&l, &back));
+
+    CHECK(lseek(fileno(f), 0, SEEK_SET) == 0);
+    CHECK(llist_load(&back, fileno(f)) == LLIST_OK);
+    CHECK(back.len == 2 * l.len && back.bytes == 2 * l.bytes);
+    fclose(f);
+    llist_clear(&back);
+    llist_clear(&l);
+}
+
+// Checks that a file cut inside its largest element fails to load, keeping 
+// the elements before it and nothing of the cut one. 
+//
+// PARAMS: 
+// arena - whether to use arena mode
+static void test_truncated(bool arena) {
+    llist_t l;
+    llist_t back;
+    fill(&l, arena);
+    FILE *f = tmpfile();
+    CHECK(f != NULL);
+    if (f == NULL)
+        return;
+
+    CHECK(llist_save(&l, fileno(f)) == LLIST_OK);
+    off_t end = lseek(fileno(f), 0, SEEK_END);
+    CHECK(ftruncate(fileno(f), end - TEST_HUGE / 2) == 0);
+    CHECK(lseek(fileno(f), 0, SEEK_SET) == 0);
+    if (arena)
+        llist_init_arena(&back, 0);
+    else
+        llist_init(&back);
+    CHECK(llist_load(&back, fileno(f)) == LLIST_IO_ERR);
+    CHECK(back.len == TEST_LEN - 1 && back.bytes == l.bytes - TEST_HUGE);
+    fclose(f);
+    llist_clear(&back);
+    llist_clear(&l);
+}
+
+// Checks that a file without the magic number is rejected. 
+static void test_bad_magic(void) {
+    FILE *f = tmpfile();
+    CHECK(f != NULL);
+    if (f == NULL)
+        return;
+
+    CHECK(fwrite("LLS0\0", 1, 5, f) == 5 && fflush(f) == 0);
+    CHECK(lseek(fileno(f), 0, SEEK_SET) == 0);
+    llist_t l;
+    llist_init(&l);
+    CHECK(llist_load(&l, fileno(f)) == LLIST_IO_ERR);
+    CHECK(l.len == 0);
+    CHECK(llist_load(NULL, fileno(f)) == LLIST_NULL_ERR);
+    CHECK(llist_load(&l, -1) == LLIST_NULL_ERR);
+    CHECK(llist_save(&l, -1) == LLIST_NULL_ERR);
+    fclose(f);
+    llist_clear(&l);
+}
@@ -0,0 +1,172 @@
+///////////////////////////////////////////////////////////////////////////////
+// llist_memory_test.c
+// Tests for llist_memory_usage and the global memory budget in C99. 
+//
+// Author: agent
+// Date:   17/10/2026
+///////////////////////////////////////////////////////////////////////////////
+
+#include "llist.h"
+#include "check.h"
+
+#define TEST_LEN 1000                       // elements in each test list
+#define TEST_BIG 300                        // size of an out of line element
+#define TEST_BUDGET 65536                   // budget for the budget tests
+
+static bool balanced(const llist_t *l);
+static void test_usage(bool arena);
+static void test_freeze(void);
+static void test_budget(bool arena);
+static void test_unmetered(void);
+
+int main(void) {
+    test_usage(false);
+    test_usage(true);
+    test_freeze();
+    test_budget(false);
+    test_budget(true);
+    test_unmetered();
+    return check_done("llist_memory_test");
+}
+
+// Returns whether the footprint of the given linked list adds up to the bytes 
+// it took, with the payload matching its element sizes. 
+//
+// PARAMS: 
+// l - the linked list to check
+//
+// RET: 
+// True (1) if the footprint adds up, 0 (false) otherwise. 
+static bool balanced(const llist_t *l) {
+    llist_memory_t m;
+    if (llist_memory_usage(l, &m) != LLIST_OK)
+        return false;
+    size_t bytes = 0;
+    for (const lnode_t *n = l->head; n != NULL; n = n->next)
+        bytes += n->size;
+    return m.payload == bytes && bytes == l->bytes && 
+        m.nodes >= l->len * 2 * sizeof(void *) && 
+        m.nodes + m.payload + m.overhead == l->heap;
+}
+
+// Checks that the footprint follows adds, inserts and deletes of small and 
+// large elements, and drops to zero once the list is cleared. 
+//
+// PARAMS: 
+// arena - whether to use arena mode
+static void test_usage(bool arena) {
+    llist_t l;
+    if (arena)
+        llist_init_arena(&l, 0);
+    else
+        llist_init(&l);
+    llist_memory_t m;
+    CHECK(llist_memory_usage(&l, &m) == LLIST_OK);
+    CHECK(m.nodes == 0 && m.payload == 0 && m.overhead == 0);
+
+    unsigned char d[TEST_BIG];
+    memset(d, 0x5a, sizeof d);
+    for (size_t i = 0; i < TEST_LEN; i++) {
+        size_t n = (i % 4 == 0) ? TEST_BIG : i % 16 + 1;
+        CHECK(llist_add(&l, d, n) == LLIST_OK);
+    }
+    CHECK(balanced(&l));
+    CHECK(llist_ins(&l, d, TEST_BIG, TEST_LEN / 2) == LLIST_OK);
+    CHECK(balanced(&l));
+
+    size_t heap = l.heap;
+    for (size_t i = 0; i < TEST_LEN / 2; i++) {
+        void *e = llist_del(&l, i);
+        CHECK(e != NULL);
+        if (!arena)
+            free(e);
+    }
+    CHECK(balanced(&l) && l.len == TEST_LEN / 2 + 1);
+    CHECK(arena ? l.heap == heap : l.heap < heap);  // arena keeps its chunks
+
+    CHECK(llist_memory_usage(NULL, &m) == LLIST_NULL_ERR);
+    CHECK(llist_memory_usage(&l, NULL) == LLIST_NULL_ERR);
+    llist_clear(&l);
+    CHECK(l.heap == 0 && l.bytes == 0 && balanced(&l));
+}
+
+// Checks that the index of a frozen list is counted as overhead until the 
+// list is thawed. 
+static void test_freeze(void) {
+    llist_t l;
+    llist_init(&l);
+    for (size_t i = 0; i < TEST_LEN; i++)
+        CHECK(llist_add(&l, &i, sizeof i) == LLIST_OK);
+    llist_memory_t before;
+    llist_memory_t frozen;
+    CHECK(llist_memory_usage(&l, &before) == LLIST_OK);
+    CHECK(llist_freeze(&l) == LLIST_OK);
+    CHECK(llist_memory_usage(&l, &frozen) == LLIST_OK);
+    CHECK(frozen.overhead >= before.overhead + TEST_LEN * sizeof(void *));
+    CHECK(frozen.nodes == before.nodes && balanced(&l));
+    llist_thaw(&l);
+    CHECK(llist_memory_usage(&l, &frozen) == LLIST_OK);
+    CHECK(frozen.overhead == before.overhead);
+    llist_clear(&l);
+}
+
+// Checks that a metered list fails with LLIST_BUDGET_ERR once the budget is 
+// spent, unchanged, and can grow again after deletes or a clear. 
+//
+// PARAMS: 
+// arena - whether to use arena mode
+static void test_budget(bool arena) {
+    llist_set_budget(TEST_BUDGET);
+    CHECK(llist_budget_used() == 0);
+    llist_t l;
+    if (arena)
+        llist_init_arena(&l, 4096);
+    else
+        llist_init(&l);
+    CHECK(l.metered);
+
+    unsigned char d[TEST_BIG];
+    memset(d, 0xa5, sizeof d);
+    int ret = LLIST_OK;
+    while (ret == LLIST_OK && l.len < TEST_BUDGET)
+        ret = llist_add(&l, d, sizeof d);
+    CHECK(ret == LLIST_BUDGET_ERR && l.len > 0);
+    CHECK(llist_budget_used() == l.heap && l.heap <= TEST_BUDGET);
+    size_t len = l.len;
+    size_t heap = l.heap;
+    CHECK(llist_ins(&l, d, sizeof d, 0) == LLIST_BUDGET_ERR);
+    CHECK(l.len == len && l.heap == heap && balanced(&l));
+
+    if (!arena) {                           // deletes give bytes back
+        free(llist_del(&l, 0));
+        free(llist_del(&l, 0));
+        CHECK(llist_budget_used() == l.heap);
+        CHECK(llist_add(&l, d, sizeof d) == LLIST_OK);
+    }
+    llist_clear(&l);
+    CHECK(llist_budget_used() == 0);
+    CHECK(llist_add(&l, d, sizeof d) == LLIST_OK);
+    CHECK(llist_budget_used() == l.heap);
+    llist_clear(&l);
+    llist_set_budget(0);
+}
+
+// Checks that lists initialised without a budget are not charged to one set 
+// later, and that disabling the budget lifts the limit. 
+static void test_unmetered(void) {
+    llist_t l;
+    llist_init(&l);
+    llist_set_budget(1);
+    size_t v = 0;
+    CHECK(!l.metered && llist_add(&l, &v, sizeof v) == LLIST_OK);
+    CHECK(llist_budget_used() == 0);
+
+    llist_t m;
+    llist_init(&m);
+    CHECK(m.metered && llist_add(&m, &v, sizeof v) == LLIST_BUDGET_ERR);
+    llist_set_budget(0);
+    CHECK(llist_add(&m, &v, sizeof v) == LLIST_OK);
+    llist_clear(&m);
+    llist_clear(&l);
+    CHECK(llist_budget_used() == 0);
+}
@@ -0,0 +1,169 @@
+///////////////////////////////////////////////////////////////////////////////
+// llist_parallel_test.c
+// Tests for llist_parallel_for_each and llist_parallel_reduce in C99. 
+//
+// Author: agent
+// Date:   17/10/2026
+///////////////////////////////////////////////////////////////////////////////
+
+#include "llist.h"
+#include "check.h"
+
+#define TEST_LEN 50000                      // elements, several chunks
+#define TEST_THREADS 64                     // more threads than chunks
+
+static void fill(llist_t *l, bool arena);
+static void bump(void *d, size_t n, void *ctx);
+static void sum_map(void *acc, const void *d, size_t n, void *ctx);
+static void sum_combine(void *acc, const void *rhs, void *ctx);
+static void test_for_each(bool arena);
+static void test_reduce(void);
+static void test_empty(void);
+static void test_args(void);
+
+int main(void) {
+    test_for_each(false);
+    test_for_each(true);
+    test_reduce();
+    test_empty();
+    test_args();
+    return check_done("llist_parallel_test");
+}
+
+// Initialises the given linked list and fills it with TEST_LEN doubles, the 
+// element at index i holding 1 / (i + 1). 
+//
+// PARAMS: 
+// l     - the linked list to fill
+// arena - whether to use arena mode
+static void fill(llist_t *l, bool arena) {
+    if (arena)
+        llist_init_arena(l, 0);
+    else
+        llist_init(l);
+    for (size_t i = 0; i < TEST_LEN; i++) {
+        double v = 1.0 / (double)(i + 1);
+        CHECK(llist_add(l, &v, sizeof v) == LLIST_OK);
+    }
+}
+
+// Adds one to the given double, counting the visits of each element. 
+//
+// PARAMS: 
+// d   - the element
+// n   - the size of the element
+// ctx - unused
+static void bump(void *d, size_t n, void *ctx) {
+    (void)ctx;
+    (void)n;
+    *(double *)d += 1.0;
+}
+
+// Adds an element to a floating-point sum. 
+//
+// PARAMS: 
+// acc - the accumulator
+// d   - the element
+// n   - the size of the element
+// ctx - unused
+static void sum_map(void *acc, const void *d, size_t n, void *ctx) {
+    (void)ctx;
+    (void)n;
+    double v = 0;
+    memcpy(&v, d, sizeof v);
+    *(double *)acc += v;
+}
+
+// Adds one floating-point sum to another. 
+//
+// PARAMS: 
+// acc - the accumulator to add to
+// rhs - the accumulator to add
+// ctx - unused
+static void sum_combine(void *acc, const void *rhs, void *ctx) {
+    (void)ctx;
+    *(double *)acc += *(const double *)rhs;
+}
+
+// Checks that every element is visited exactly once for any thread count, 
+// including more threads than chunks and one per CPU. 
+//
+// PARAMS: 
+// arena - whether to use arena mode
+static void test_for_each(bool arena) {
+    llist_t l;
+    fill(&l, arena);
+    size_t threads[] = { 1, 2, 3, 0, TEST_THREADS };
+    size_t rounds = sizeof threads / sizeof *threads;
+    for (size_t t = 0; t < rounds; t++)
+        CHECK(llist_parallel_for_each(&l, bump, NULL, threads[t]) == LLIST_OK);
+
+    size_t i = 0;
+    for (const lnode_t *n = l.head; n != NULL; n = n->next, i++) {
+        double v = 0;
+        double want = 1.0 / (double)(i + 1);
+        for (size_t t = 0; t < rounds; t++)
+            want += 1.0;                    // the same roundings as bump
+        memcpy(&v, lnode_data(n), sizeof v);
+        if (v != want) {
+            CHECK(false);
+            break;
+        }
+    }
+    CHECK(i == TEST_LEN);
+    llist_clear(&l);
+}
+
+// Checks that a floating-point sum gives the same bits for every thread 
+// count, and is close to the sequential sum. 
+static void test_reduce(void) {
+    llist_t l;
+    fill(&l, false);
+    double zero = 0;
+    llist_reducer_t r = { sum_map, sum_combine, &zero, sizeof zero, NULL };
+    double first = 0;
+    CHECK(llist_parallel_reduce(&l, &r, &first, 1) == LLIST_OK);
+    size_t threads[] = { 2, 3, 0, TEST_THREADS };
+    for (size_t t = 0; t < sizeof threads / sizeof *threads; t++) {
+        double sum = -1;
+        CHECK(llist_parallel_reduce(&l, &r, &sum, threads[t]) == LLIST_OK);
+        CHECK(memcmp(&sum, &first, sizeof sum) == 0);
+    }
+
+    double seq = 0;
+    for (const lnode_t *n = l.head; n != NULL; n = n->next)
+        sum_map(&seq, lnode_data(n), n->size, NULL);
+    CHECK(first - seq < 1e-9 && seq - first < 1e-9);
+    llist_clear(&l);
+}
+
+// Checks that empty lists are traversed without calls, and reduce to the 
+// identity. 
+static void test_empty(void) {
+    llist_t l;
+    llist_init(&l);
+    CHECK(llist_parallel_for_each(&l, bump, NULL, 4) == LLIST_OK);
+    double zero = 0;
+    double sum = -1;
+    llist_reducer_t r = { sum_map, sum_combine, &zero, sizeof zero, NULL };
+    CHECK(llist_parallel_reduce(&l, &r, &sum, 4) == LLIST_OK && sum == 0);
+}
+
+// Checks that missing lists, functions and reducer fields are rejected. 
+static void test_args(void) {
+    llist_t l;
+    llist_init(&l);
+    double zero = 0;
+    double sum = 0;
+    llist_reducer_t r = { sum_map, sum_combine, &zero, sizeof zero, NULL };
+    CHECK(llist_parallel_for_each(NULL, bump, NULL, 1) == LLIST_NULL_ERR);
+    CHECK(llist_parallel_for_each(&l, NULL, NULL, 1) == LLIST_NULL_ERR);
+    CHECK(llist_parallel_reduce(NULL, &r, &sum, 1) == LLIST_NULL_ERR);
+    CHECK(llist_parallel_reduce(&l, NULL, &sum, 1) == LLIST_NULL_ERR);
+    CHECK(llist_parallel_reduce(&l, &r, NULL, 1) == LLIST_NULL_ERR);
+    r.size = 0;
+    CHECK(llist_parallel_reduce(&l, &r, &sum, 1) == LLIST_NULL_ERR);
+    r.size = sizeof zero;
+    r.map = NULL;
+    CHECK(llist_parallel_reduce(&l, &r, &sum, 1) == LLIST_NULL_ERR);
+}
@@ -0,0 +1,196 @@
+///////////////////////////////////////////////////////////////////////////////
+// llist_reorder_test.c
+// Tests for llist_reverse, llist_rotate and llist_split in C99. 
+//
+// Author: agent
+// Date:   17/10/2026
+///////////////////////////////////////////////////////////////////////////////
+
+#include "llist.h"
+#include "check.h"
+
+#define TEST_LEN 1000                       // elements in each test list
+#define TEST_BIG 100                        // size of an out of line element
+
+static void fill(llist_t *l, bool arena);
+static bool in_order(const llist_t *l, size_t first);
+static size_t value(const void *d);
+static void test_reverse_rotate(bool arena);
+static void test_no_copy(void);
+static void test_split(void);
+static void test_split_handles(void);
+static void test_small(void);
+
+int main(void) {
+    test_reverse_rotate(false);
+    test_reverse_rotate(true);
+    test_no_copy();
+    test_split();
+    test_split_handles();
+    test_small();
+    return check_done("llist_reorder_test");
+}
+
+// Initialises the given linked list and fills it with TEST_LEN elements. The 
+// element at index i starts with i as a size_t, and every third element is 
+// stored out of line. 
+//
+// PARAMS: 
+// l     - the linked list to fill
+// arena - whether to use arena mode
+static void fill(llist_t *l, bool arena) {
+    if (arena)
+        llist_init_arena(l, 4096);
+    else
+        llist_init(l);
+
+    unsigned char d[TEST_BIG];
+    for (size_t i = 0; i < TEST_LEN; i++) {
+        memset(d, (int)(i & 0xff), sizeof d);
+        memcpy(d, &i, sizeof i);
+        size_t n = (i % 3 == 0) ? TEST_BIG : sizeof i + i % 5;
+        CHECK(llist_add(l, d, n) == LLIST_OK);
+    }
+}
+
+// Returns whether the elements of a linked list made by fill count up from 
+// the given value, wrapping at TEST_LEN, and are linked consistently. 
+//
+// PARAMS: 
+// l     - the linked list to check
+// first - the value of the head element
+//
+// RET: 
+// True (1) if the elements are in order, 0 (false) otherwise. 
+static bool in_order(const llist_t *l, size_t first) {
+    size_t i = 0;
+    for (const lnode_t *n = l->head; n != NULL; n = n->next, i++) {
+        if (value(lnode_data(n)) != (first + i) % TEST_LEN)
+            return false;
+        if ((n->prev == NULL) != (n == l->head))
+            return false;
+        if (n->next != NULL && n->next->prev != n)
+            return false;
+    }
+    return i == l->len && (l->len == 0 || l->tail->next == NULL);
+}
+
+// Returns the size_t stored at the start of an element. 
+//
+// PARAMS: 
+// d - the element
+//
+// RET: 
+// The value of the element. 
+static size_t value(const void *d) {
+    size_t v = 0;
+    memcpy(&v, d, sizeof v);
+    return v;
+}
+
+// Checks rotations by zero, by a few places, by whole turns and back, and 
+// that reversing twice restores the list. 
+//
+// PARAMS: 
+// arena - whether to use arena mode
+static void test_reverse_rotate(bool arena) {
+    llist_t l;
+    fill(&l, arena);
+    CHECK(llist_rotate(&l, 0) == LLIST_OK && in_order(&l, 0));
+    CHECK(llist_rotate(&l, 7) == LLIST_OK && in_order(&l, 7));
+    CHECK(llist_rotate(&l, TEST_LEN - 7) == LLIST_OK && in_order(&l, 0));
+    CHECK(llist_rotate(&l, 3 * TEST_LEN + 1) == LLIST_OK && in_order(&l, 1));
+    CHECK(llist_rotate(&l, TEST_LEN - 1) == LLIST_OK && in_order(&l, 0));
+
+    CHECK(llist_reverse(&l) == LLIST_OK);
+    size_t i = TEST_LEN;
+    for (const lnode_t *n = l.head; n != NULL; n = n->next)
+        CHECK(value(lnode_data(n)) == --i);
+    CHECK(i == 0 && l.head->prev == NULL && l.tail->next == NULL);
+    CHECK(value(llist_get(&l, TEST_LEN - 1)) == 0);
+    CHECK(llist_reverse(&l) == LLIST_OK && in_order(&l, 0));
+    llist_clear(&l);
+}
+
+// Checks that reversing and rotating relink the nodes in place, so elements 
+// keep their addresses and nothing is allocated. 
+static void test_no_copy(void) {
+    llist_t l;
+    fill(&l, false);
+    const void *first = llist_get(&l, 0);
+    const void *last = llist_get(&l, TEST_LEN - 1);
+    size_t heap = l.heap;
+    CHECK(llist_reverse(&l) == LLIST_OK);
+    CHECK(llist_get(&l, 0) == last && llist_get(&l, SIZE_MAX) == first);
+    CHECK(llist_rotate(&l, TEST_LEN - 1) == LLIST_OK);
+    CHECK(llist_get(&l, 0) == first && llist_get(&l, 1) == last);
+    CHECK(l.heap == heap);
+    llist_clear(&l);
+}
+
+// Checks splits at both ends and in either half, that the sums of the two 
+// lists match the original, and that arena lists are refused unchanged. 
+static void test_split(void) {
+    size_t at[] = { 0, 1, TEST_LEN / 3, TEST_LEN / 2, TEST_LEN - 1, TEST_LEN };
+    for (size_t k = 0; k < sizeof at / sizeof at[0]; k++) {
+        llist_t l;
+        llist_t o;
+        fill(&l, false);
+        size_t bytes = l.bytes;
+        size_t heap = l.heap;
+        CHECK(llist_split(&l, at[k], &o) == LLIST_OK);
+        CHECK(l.len == at[k] && o.len == TEST_LEN - at[k]);
+        CHECK(l.bytes + o.bytes == bytes && l.heap + o.heap == heap);
+        CHECK(in_order(&l, 0) && in_order(&o, at[k] % TEST_LEN));
+
+        size_t v = TEST_LEN;                // both lists still grow
+        CHECK(llist_add(&l, &v, sizeof v) == LLIST_OK);
+        CHECK(llist_add(&o, &v, sizeof v) == LLIST_OK);
+        llist_clear(&l);
+        llist_clear(&o);
+        CHECK(l.heap == 0 && o.heap == 0);
+    }
+
+    llist_t l;
+    llist_t o;
+    fill(&l, true);
+    CHECK(llist_split(&l, 1, &o) == LLIST_MODE_ERR);
+    CHECK(l.len == TEST_LEN && in_order(&l, 0));
+    CHECK(llist_split(&l, 1, &l) == LLIST_NULL_ERR);
+    CHECK(llist_split(NULL, 1, &o) == LLIST_NULL_ERR);
+    llist_clear(&l);
+}
+
+// Checks that handles to elements moved by a split go stale, while handles 
+// to the kept elements still work. 
+static void test_split_handles(void) {
+    llist_t l;
+    llist_init(&l);
+    llist_handle_t h[TEST_LEN];
+    for (size_t i = 0; i < TEST_LEN; i++)
+        CHECK(llist_add_handle(&l, &i, sizeof i, &h[i]) == LLIST_OK);
+    llist_t o;
+    CHECK(llist_split(&l, TEST_LEN / 4, &o) == LLIST_OK);
+    CHECK(value(llist_get_handle(&l, h[0])) == 0);
+    CHECK(value(llist_get_handle(&l, h[TEST_LEN / 4 - 1])) == TEST_LEN / 4 - 1);
+    CHECK(llist_get_handle(&l, h[TEST_LEN / 4]) == NULL);
+    CHECK(llist_get_handle(&l, h[TEST_LEN - 1]) == NULL);
+    CHECK(in_order(&o, TEST_LEN / 4));
+    llist_clear(&o);
+    llist_clear(&l);
+}
+
+// Checks empty and single element lists, and missing lists. 
+static void test_small(void) {
+    llist_t l;
+    llist_init(&l);
+    CHECK(llist_reverse(&l) == LLIST_OK && l.head == NULL);
+    CHECK(llist_rotate(&l, 5) == LLIST_OK && l.head == NULL);
+    size_t v = 0;
+    CHECK(llist_add(&l, &v, sizeof v) == LLIST_OK);
+    CHECK(llist_reverse(&l) == LLIST_OK && l.head == l.tail);
+    CHECK(llist_rotate(&l, 5) == LLIST_OK && in_order(&l, 0));
+    CHECK(llist_reverse(NULL) == LLIST_NULL_ERR);
+    CHECK(llist_rotate(NULL, 1) == LLIST_NULL_ERR);
+    llist_clear(&l);
+}
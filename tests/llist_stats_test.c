@@ -0,0 +1,130 @@
+///////////////////////////////////////////////////////////////////////////////
+// llist_stats_test.c
+// Tests for the llist_t operation counters in C99, built together with 
+// llist.c with LLIST_STATS and LLIST_TRACE defined. 
+//
+// Author: agent
+// Date:   17/10/2026
+///////////////////////////////////////////////////////////////////////////////
+
+#include "llist.h"
+#include "check.h"
+
+#define TEST_LEN 100                        // elements in each test list
+
+static bool zero(const llist_t *l);
+static void test_counts(void);
+static void test_ins_tail(void);
+static void test_lookups(void);
+static void test_bytes(void);
+
+int main(void) {
+    test_counts();
+    test_ins_tail();
+    test_lookups();
+    test_bytes();
+    return check_done("llist_stats_test");
+}
+
+// Returns whether every counter of the given linked list is zero. 
+//
+// PARAMS: 
+// l - the linked list to check
+//
+// RET: 
+// True (1) if every counter is zero, 0 (false) otherwise. 
+static bool zero(const llist_t *l) {
+    llist_stats_t s;
+    if (llist_stats(l, &s) != LLIST_OK)
+        return false;
+    const unsigned char *b = (const unsigned char *)&s;
+    for (size_t i = 0; i < sizeof s; i++) {
+        if (b[i] != 0)
+            return false;
+    }
+    return true;
+}
+
+// Checks that every add, insert, delete and get is counted once, and that 
+// reset clears the counters. 
+static void test_counts(void) {
+    llist_t l;
+    llist_init(&l);
+    CHECK(zero(&l));
+    for (size_t i = 0; i < TEST_LEN; i++)
+        CHECK(llist_add(&l, &i, sizeof i) == LLIST_OK);
+    size_t v = 0;
+    CHECK(llist_ins(&l, &v, sizeof v, 0) == LLIST_OK);
+    CHECK(llist_ins(&l, &v, sizeof v, TEST_LEN / 2) == LLIST_OK);
+    for (size_t i = 0; i < 3; i++)
+        CHECK(llist_get(&l, i) != NULL);
+    free(llist_del(&l, 0));
+
+    llist_stats_t s;
+    CHECK(llist_stats(&l, &s) == LLIST_OK);
+    CHECK(s.adds == TEST_LEN && s.inss == 2);
+    CHECK(s.gets == 3 && s.dels == 1);
+    llist_stats_reset(&l);
+    CHECK(zero(&l));
+    CHECK(llist_stats(NULL, &s) == LLIST_NULL_ERR);
+    CHECK(llist_stats(&l, NULL) == LLIST_NULL_ERR);
+    llist_stats_reset(NULL);
+    llist_clear(&l);
+}
+
+// Checks that inserts at or past the end, and into an empty list, count as 
+// inserts rather than adds. 
+static void test_ins_tail(void) {
+    llist_t l;
+    llist_init(&l);
+    size_t v = 0;
+    CHECK(llist_ins(&l, &v, sizeof v, 0) == LLIST_OK);
+    CHECK(llist_ins(&l, &v, sizeof v, 1) == LLIST_OK);
+    CHECK(llist_ins(&l, &v, sizeof v, SIZE_MAX) == LLIST_OK);
+    CHECK(l.len == 3 && l.tail->prev->next == l.tail);
+
+    llist_stats_t s;
+    CHECK(llist_stats(&l, &s) == LLIST_OK);
+    CHECK(s.inss == 3 && s.adds == 0);
+    llist_clear(&l);
+}
+
+// Checks that lookups record their pointer hops from the nearer end, the 
+// worst of them, and the index histogram. 
+static void test_lookups(void) {
+    llist_t l;
+    llist_init(&l);
+    for (size_t i = 0; i < TEST_LEN; i++)
+        CHECK(llist_add(&l, &i, sizeof i) == LLIST_OK);
+    llist_stats_reset(&l);
+    CHECK(*(size_t *)llist_get(&l, 0) == 0);
+    CHECK(*(size_t *)llist_get(&l, 5) == 5);
+    CHECK(*(size_t *)llist_get(&l, TEST_LEN - 10) == TEST_LEN - 10);
+    CHECK(*(size_t *)llist_get(&l, SIZE_MAX) == TEST_LEN - 1);
+
+    llist_stats_t s;
+    CHECK(llist_stats(&l, &s) == LLIST_OK);
+    CHECK(s.gets == 4 && s.lookups == 4);
+    CHECK(s.hops == 5 + 9 && s.max_hops == 9);
+    CHECK(s.hist[0] == 1 && s.hist[3] == 1 && s.hist[7] == 2);
+    llist_clear(&l);
+}
+
+// Checks that bytes allocated and handed back balance once the list is 
+// cleared. 
+static void test_bytes(void) {
+    llist_t l;
+    llist_init(&l);
+    for (size_t i = 0; i < TEST_LEN; i++)
+        CHECK(llist_add(&l, &i, sizeof i) == LLIST_OK);
+    llist_stats_t s;
+    CHECK(llist_stats(&l, &s) == LLIST_OK);
+    CHECK(s.alloc_bytes >= TEST_LEN * sizeof(size_t) && s.free_bytes == 0);
+
+    free(llist_del(&l, 0));
+    CHECK(llist_stats(&l, &s) == LLIST_OK);
+    CHECK(s.free_bytes > 0 && s.free_bytes < s.alloc_bytes);
+    llist_clear(&l);
+    CHECK(llist_stats(&l, &s) == LLIST_OK);
+    CHECK(s.free_bytes == s.alloc_bytes);
+}
@@ -0,0 +1,247 @@
+///////////////////////////////////////////////////////////////////////////////
+// llist_stream_test.c
+// Tests for llist_export_stream and llist_import_stream in C99. 
+//
+// Author: agent
+// Date:   17/10/2026
+///////////////////////////////////////////////////////////////////////////////
+
+#include "llist.h"
+#include "check.h"
+
+#define TEST_LEN 300                        // elements in each test list
+#define TEST_HUGE 200000                    // spans several stream blocks
+#define TEST_CHUNK 777                      // most bytes handed per read
+
+// The buffer type behind the stream tests. 
+typedef struct test_buf_t {
+    unsigned char *data;                    // bytes written
+    size_t len;                             // bytes in data
+    size_t pos;                             // read position
+    size_t limit;                           // writes fail past this length
+} tbuf_t;
+
+static void fill(llist_t *l, bool arena);
+static bool same(const llist_t *a, const llist_t *b);
+static int buf_write(void *ctx, const void *buf, size_t n);
+static size_t buf_read(void *ctx, void *buf, size_t n);
+static void test_round_trip(bool arena);
+static void test_empty(void);
+static void test_truncated(void);
+static void test_bad_stream(void);
+static void test_args(void);
+
+int main(void) {
+    test_round_trip(false);
+    test_round_trip(true);
+    test_empty();
+    test_truncated();
+    test_bad_stream();
+    test_args();
+    return check_done("llist_stream_test");
+}
+
+// Initialises the given linked list and fills it with TEST_LEN elements of 
+// growing sizes, from inline ones to one spanning several stream blocks. The 
+// bytes repeat, so the LZ codec finds matches. 
+//
+// PARAMS: 
+// l     - the linked list to fill
+// arena - whether to use arena mode
+static void fill(llist_t *l, bool arena) {
+    if (arena)
+        llist_init_arena(l, 0);
+    else
+        llist_init(l);
+
+    unsigned char *d = malloc(TEST_HUGE);
+    CHECK(d != NULL);
+    for (size_t i = 0; d != NULL && i < TEST_LEN; i++) {
+        size_t n = (i == TEST_LEN / 2) ? TEST_HUGE :
+            (i % 10 == 0) ? 600 + i : i % 20 + 1;
+        for (size_t j = 0; j < n; j++)
+            d[j] = (unsigned char)(i + j % 64);
+        CHECK(llist_add(l, d, n) == LLIST_OK);
+    }
+    free(d);
+}
+
+// Returns whether two linked lists hold equal elements in the same order, 
+// and the second is linked consistently. 
+//
+// PARAMS: 
+// a - the first linked list
+// b - the second linked list
+//
+// RET: 
+// True (1) if the lists are equal, 0 (false) otherwise. 
+static bool same(const llist_t *a, const llist_t *b) {
+    if (a->len != b->len || a->bytes != b->bytes)
+        return false;
+    const lnode_t *m = b->head;
+    for (const lnode_t *n = a->head; n != NULL; n = n->next, m = m->next) {
+        if (n->size != m->size || 
+            memcmp(lnode_data(n), lnode_data(m), n->size) != 0)
+            return false;
+        if (m->next != NULL && m->next->prev != m)
+            return false;
+    }
+    return b->len == 0 || b->tail->next == NULL;
+}
+
+// Appends bytes to a test buffer, failing once it would pass its limit. 
+//
+// PARAMS: 
+// ctx - the test buffer
+// buf - the bytes to append
+// n   - the number of bytes
+//
+// RET: 
+// Zero on success, non-zero on error. 
+static int buf_write(void *ctx, const void *buf, size_t n) {
+    tbuf_t *b = ctx;
+    if (n > b->limit - b->len)
+        return 1;
+    unsigned char *data = realloc(b->data, b->len + n);
+    if (data == NULL)
+        return 1;
+    memcpy(data + b->len, buf, n);
+    b->data = data;
+    b->len += n;
+    return 0;
+}
+
+// Reads bytes from a test buffer, at most TEST_CHUNK at a time so blocks and 
+// frame headers arrive split across reads. 
+//
+// PARAMS: 
+// ctx - the test buffer
+// buf - where to store the bytes
+// n   - the most bytes to read
+//
+// RET: 
+// The bytes read, 0 at the end of the buffer. 
+static size_t buf_read(void *ctx, void *buf, size_t n) {
+    tbuf_t *b = ctx;
+    size_t take = b->len - b->pos;
+    take = (take < n) ? take : n;
+    take = (take < TEST_CHUNK) ? take : TEST_CHUNK;
+    memcpy(buf, b->data + b->pos, take);
+    b->pos += take;
+    return take;
+}
+
+// Checks that a list exported with either codec imports back equal through 
+// partial reads, appended to the elements a list already has, and that the 
+// LZ codec makes the repetitive stream smaller. 
+//
+// PARAMS: 
+// arena - whether to use arena mode
+static void test_round_trip(bool arena) {
+    llist_t l;
+    fill(&l, arena);
+    size_t sizes[2] = { 0, 0 };
+    for (int codec = LLIST_CODEC_NONE; codec <= LLIST_CODEC_LZ; codec++) {
+        tbuf_t b = { NULL, 0, 0, SIZE_MAX };
+        CHECK(llist_export_stream(&l, buf_write, &b, codec) == LLIST_OK);
+        sizes[codec] = b.len;
+
+        llist_t back;
+        if (arena)
+            llist_init_arena(&back, 0);
+        else
+            llist_init(&back);
+        CHECK(llist_import_stream(&back, buf_read, &b) == LLIST_OK);
+        CHECK(b.pos == b.len && same(&l, &back));
+
+        b.pos = 0;                          // import again after the copy
+        CHECK(llist_import_stream(&back, buf_read, &b) == LLIST_OK);
+        CHECK(back.len == 2 * TEST_LEN && back.bytes == 2 * l.bytes);
+        llist_clear(&back);
+        free(b.data);
+    }
+    CHECK(sizes[LLIST_CODEC_NONE] > l.bytes);
+    CHECK(sizes[LLIST_CODEC_LZ] < sizes[LLIST_CODEC_NONE] / 2);
+    llist_clear(&l);
+}
+
+// Checks that an empty list round trips to an empty list. 
+static void test_empty(void) {
+    llist_t l;
+    llist_init(&l);
+    tbuf_t b = { NULL, 0, 0, SIZE_MAX };
+    CHECK(llist_export_stream(&l, buf_write, &b, LLIST_CODEC_LZ) == LLIST_OK);
+    CHECK(llist_import_stream(&l, buf_read, &b) == LLIST_OK);
+    CHECK(l.len == 0 && l.head == NULL && b.pos == b.len);
+    free(b.data);
+}
+
+// Checks that a stream cut short anywhere fails to import, keeping only 
+// whole elements read before the cut. 
+static void test_truncated(void) {
+    llist_t l;
+    fill(&l, false);
+    tbuf_t b = { NULL, 0, 0, SIZE_MAX };
+    CHECK(llist_export_stream(&l, buf_write, &b, LLIST_CODEC_LZ) == LLIST_OK);
+    size_t full = b.len;
+    for (size_t cut = 0; cut < full; cut += full / 7 + 1) {
+        llist_t back;
+        llist_init(&back);
+        b.len = cut;
+        b.pos = 0;
+        CHECK(llist_import_stream(&back, buf_read, &b) != LLIST_OK);
+        CHECK(back.len < l.len);
+        const lnode_t *m = back.head;
+        for (const lnode_t *n = l.head; m != NULL; n = n->next, m = m->next)
+            CHECK(n->size == m->size && 
+                memcmp(lnode_data(n), lnode_data(m), n->size) == 0);
+        llist_clear(&back);
+    }
+    free(b.data);
+    llist_clear(&l);
+}
+
+// Checks that a stream with a wrong magic or an unknown codec is rejected. 
+static void test_bad_stream(void) {
+    llist_t l;
+    fill(&l, false);
+    tbuf_t b = { NULL, 0, 0, SIZE_MAX };
+    CHECK(llist_export_stream(&l, buf_write, &b, LLIST_CODEC_NONE) == LLIST_OK);
+    llist_t back;
+    llist_init(&back);
+
+    b.data[0] ^= 0xff;                      // magic
+    CHECK(llist_import_stream(&back, buf_read, &b) == LLIST_IO_ERR);
+    CHECK(back.len == 0);
+    b.data[0] ^= 0xff;
+    b.data[4] = 0x7f;                       // codec of the first frame
+    b.pos = 0;
+    CHECK(llist_import_stream(&back, buf_read, &b) == LLIST_IO_ERR);
+    CHECK(back.len == 0);
+    llist_clear(&back);
+    free(b.data);
+    llist_clear(&l);
+}
+
+// Checks that invalid arguments and failing writers are reported. 
+static void test_args(void) {
+    llist_t l;
+    fill(&l, false);
+    tbuf_t b = { NULL, 0, 0, SIZE_MAX };
+    CHECK(llist_export_stream(NULL, buf_write, &b, 0) == LLIST_NULL_ERR);
+    CHECK(llist_export_stream(&l, NULL, &b, 0) == LLIST_NULL_ERR);
+    CHECK(llist_export_stream(&l, buf_write, &b, 2) == LLIST_NULL_ERR);
+    CHECK(llist_import_stream(NULL, buf_read, &b) == LLIST_NULL_ERR);
+    CHECK(llist_import_stream(&l, NULL, &b) == LLIST_NULL_ERR);
+    CHECK(b.len == 0 && l.len == TEST_LEN);
+
+    CHECK(llist_export_stream(&l, buf_write, &b, 1) == LLIST_OK);
+    size_t full = b.len;
+    for (size_t limit = 0; limit < full; limit += full / 5 + 1) {
+        b.limit = limit;                    // writer fails part way
+        b.len = 0;
+        CHECK(llist_export_stream(&l, buf_write, &b, 1) == LLIST_IO_ERR);
+    }
+    free(b.data);
+    llist_clear(&l);
+}
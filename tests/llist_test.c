@@ -0,0 +1,286 @@
+///////////////////////////////////////////////////////////////////////////////
+// llist_test.c
+// Tests for llist_t in C99. 
+//
+// Author: agent
+// Date:   17/10/2026
+///////////////////////////////////////////////////////////////////////////////
+
+#include "llist.h"
+#include "check.h"
+#if defined(__GLIBC__) && !defined(__SANITIZE_ADDRESS__) && \
+    (__GLIBC__ > 2 || __GLIBC_MINOR__ >= 33)
+#include <malloc.h>
+#define TEST_MALLINFO                       // malloc can be asked its usage
+#endif
+
+#define TEST_LEN 1000                       // elements in each test list
+#define TEST_BIG 100                        // size of an out of line element
+#define TEST_SMALL 100000                   // elements in the footprint test
+
+static void fill(llist_t *l, bool arena);
+static bool in_order(const llist_t *l, size_t first);
+static size_t value(const void *d);
+static void test_add_get(void);
+static void test_ins_del(void);
+static void test_add_uninit(void);
+static void test_args(void);
+static void test_arena(void);
+static void test_compact(void);
+static void test_align(bool arena);
+
+int main(void) {
+    test_add_get();
+    test_ins_del();
+    test_add_uninit();
+    test_args();
+    test_arena();
+    test_compact();
+    test_align(false);
+    test_align(true);
+    return check_done("llist_test");
+}
+
+// Initialises the given linked list and fills it with TEST_LEN elements. The 
+// element at index i starts with i as a size_t, and every third element is 
+// stored out of line. 
+//
+// PARAMS: 
+// l     - the linked list to fill
+// arena - whether to use arena mode
+static void fill(llist_t *l, bool arena) {
+    if (arena)
+        llist_init_arena(l, 4096);
+    else
+        llist_init(l);
+
+    unsigned char d[TEST_BIG];
+    for (size_t i = 0; i < TEST_LEN; i++) {
+        memset(d, (int)(i & 0xff), sizeof d);
+        memcpy(d, &i, sizeof i);
+        size_t n = (i % 3 == 0) ? TEST_BIG : sizeof i + i % 5;
+        CHECK(llist_add(l, d, n) == LLIST_OK);
+    }
+}
+
+// Returns whether the elements of a linked list made by fill count up from 
+// the given value, wrapping at TEST_LEN, and are linked consistently. 
+//
+// PARAMS: 
+// l     - the linked list to check
+// first - the value of the head element
+//
+// RET: 
+// True (1) if the elements are in order, 0 (false) otherwise. 
+static bool in_order(const llist_t *l, size_t first) {
+    size_t i = 0;
+    for (const lnode_t *n = l->head; n != NULL; n = n->next, i++) {
+        if (value(lnode_data(n)) != (first + i) % TEST_LEN)
+            return false;
+        if ((n->prev == NULL) != (n == l->head))
+            return false;
+        if (n->next != NULL && n->next->prev != n)
+            return false;
+    }
+    return i == l->len && (l->len == 0 || l->tail->next == NULL);
+}
+
+// Returns the size_t stored at the start of an element. 
+//
+// PARAMS: 
+// d - the element
+//
+// RET: 
+// The value of the element. 
+static size_t value(const void *d) {
+    size_t v = 0;
+    memcpy(&v, d, sizeof v);
+    return v;
+}
+
+// Checks that added elements are copied, kept in order and found by index 
+// from either end, and that out of range indices give the last element. 
+static void test_add_get(void) {
+    llist_t l;
+    fill(&l, false);
+    CHECK(l.len == TEST_LEN && in_order(&l, 0));
+    for (size_t i = 0; i < TEST_LEN; i += 37)
+        CHECK(value(llist_get(&l, i)) == i);
+    CHECK(value(llist_get(&l, TEST_LEN)) == TEST_LEN - 1);
+    CHECK(value(llist_get(&l, SIZE_MAX)) == TEST_LEN - 1);
+
+    unsigned char *big = llist_get(&l, 3);
+    CHECK(big[TEST_BIG - 1] == 3);          // out of line bytes kept
+    llist_clear(&l);
+    CHECK(l.len == 0 && l.head == NULL && l.tail == NULL);
+    CHECK(llist_get(&l, 0) == NULL);
+    llist_clear(&l);                        // clearing twice is harmless
+}
+
+// Checks inserting at the head, middle and past the end, and deleting from 
+// each of them, with the deleted elements handed back to the caller. 
+static void test_ins_del(void) {
+    llist_t l;
+    llist_init(&l);
+    for (size_t i = 1; i < TEST_LEN - 1; i++)
+        CHECK(llist_add(&l, &i, sizeof i) == LLIST_OK);
+    size_t v = 0;
+    CHECK(llist_ins(&l, &v, sizeof v, 0) == LLIST_OK);
+    v = TEST_LEN - 1;
+    CHECK(llist_ins(&l, &v, sizeof v, SIZE_MAX) == LLIST_OK);
+    CHECK(in_order(&l, 0));
+
+    v = TEST_LEN;
+    CHECK(llist_ins(&l, &v, sizeof v, TEST_LEN / 2) == LLIST_OK);
+    CHECK(value(llist_get(&l, TEST_LEN / 2)) == TEST_LEN);
+    CHECK(value(llist_get(&l, TEST_LEN / 2 + 1)) == TEST_LEN / 2);
+
+    size_t *d = llist_del(&l, TEST_LEN / 2);
+    CHECK(d != NULL && *d == TEST_LEN);
+    free(d);
+    CHECK(in_order(&l, 0));
+    d = llist_del(&l, 0);
+    CHECK(d != NULL && *d == 0);
+    free(d);
+    d = llist_del(&l, SIZE_MAX);            // out of range takes the last
+    CHECK(d != NULL && *d == TEST_LEN - 1);
+    free(d);
+    CHECK(l.len == TEST_LEN - 2 && in_order(&l, 1));
+
+    while (l.len > 0)
+        free(llist_del(&l, l.len / 2));
+    CHECK(l.head == NULL && l.tail == NULL);
+    CHECK(llist_del(&l, 0) == NULL);
+    llist_clear(&l);
+}
+
+// Checks that elements added unset are stored where they were filled, in 
+// their node or out of line. 
+static void test_add_uninit(void) {
+    llist_t l;
+    llist_init(&l);
+    for (size_t n = 1; n <= TEST_BIG; n += 33) {
+        void *d = NULL;
+        CHECK(llist_add_uninit(&l, n, &d) == LLIST_OK && d != NULL);
+        memset(d, (int)n, n);
+    }
+    CHECK(l.len == 4 && l.bytes == 1 + 34 + 67 + 100);
+    for (const lnode_t *n = l.head; n != NULL; n = n->next) {
+        const unsigned char *e = lnode_data(n);
+        CHECK(e[0] == n->size && e[n->size - 1] == n->size);
+    }
+    void *d = &l;
+    CHECK(llist_add_uninit(&l, 0, &d) == LLIST_NULL_ERR && d == NULL);
+    CHECK(llist_add_uninit(&l, 1, NULL) == LLIST_NULL_ERR);
+    CHECK(l.len == 4);
+    llist_clear(&l);
+}
+
+// Checks that invalid arguments are rejected without touching the list. 
+static void test_args(void) {
+    llist_t l;
+    size_t v = 1;
+    CHECK(llist_init(NULL) == LLIST_NULL_ERR);
+    llist_init(&l);
+    CHECK(llist_add(NULL, &v, sizeof v) == LLIST_NULL_ERR);
+    CHECK(llist_add(&l, NULL, sizeof v) == LLIST_NULL_ERR);
+    CHECK(llist_add(&l, &v, 0) == LLIST_NULL_ERR);
+    CHECK(llist_ins(&l, &v, 0, 0) == LLIST_NULL_ERR);
+    CHECK(llist_get(NULL, 0) == NULL);
+    CHECK(llist_del(NULL, 0) == NULL);
+    CHECK(l.len == 0);
+    llist_clear(NULL);
+}
+
+// Checks that arena lists keep deleted elements until cleared, take elements 
+// larger than a chunk, and give back every byte they accounted for. 
+static void test_arena(void) {
+    llist_t l;
+    for (int round = 0; round < 2; round++) {   // refilled after a clear
+        fill(&l, true);
+        CHECK(in_order(&l, 0) && l.arena != NULL && l.arena->next != NULL);
+        size_t *kept = llist_del(&l, 1);
+        CHECK(kept != NULL && *kept == 1 && l.len == TEST_LEN - 1);
+        CHECK(value(llist_get(&l, 1)) == 2);
+        CHECK(*kept == 1);                  // still valid until cleared
+
+        unsigned char huge[3 * 4096];
+        memset(huge, 0xab, sizeof huge);
+        CHECK(llist_add(&l, huge, sizeof huge) == LLIST_OK);
+        unsigned char *back = llist_get(&l, SIZE_MAX);
+        CHECK(back != NULL && memcmp(back, huge, sizeof huge) == 0);
+
+        llist_memory_t m;
+        CHECK(llist_memory_usage(&l, &m) == LLIST_OK);
+        CHECK(m.payload == l.bytes && m.overhead < l.heap);
+        llist_clear(&l);
+        CHECK(l.len == 0 && l.head == NULL && l.tail == NULL);
+        CHECK(l.bytes == 0 && l.heap == 0 && l.arena == NULL);
+        CHECK(llist_memory_usage(&l, &m) == LLIST_OK);
+        CHECK(m.nodes == 0 && m.payload == 0 && m.overhead == 0);
+    }
+    llist_clear(&l);
+}
+
+// Checks that a 4 byte element costs under half of the 64 bytes a separately 
+// malloced node and element took, by the accounting of the list and, where 
+// glibc can tell, by malloc itself, and that deleted nodes are reused. 
+static void test_compact(void) {
+    CHECK(sizeof(lnode_t) <= 40);
+#ifdef TEST_MALLINFO
+    size_t before = mallinfo2().uordblks;
+#endif
+    llist_t l;
+    llist_init(&l);
+    for (uint32_t i = 0; i < TEST_SMALL; i++)
+        CHECK(llist_add(&l, &i, sizeof i) == LLIST_OK);
+    CHECK(l.heap / l.len <= 24);
+#ifdef TEST_MALLINFO
+    CHECK((mallinfo2().uordblks - before) / l.len < 32);
+#endif
+    llist_memory_t m;
+    CHECK(llist_memory_usage(&l, &m) == LLIST_OK);
+    CHECK(m.payload == TEST_SMALL * sizeof(uint32_t));
+    CHECK(m.nodes + m.payload + m.overhead == l.heap);
+
+    const lnode_t *old = l.head;
+    size_t heap = l.heap;
+    uint32_t *d = llist_del(&l, 0);
+    CHECK(d != NULL && *d == 0 && l.heap < heap);
+    CHECK(llist_add(&l, d, sizeof *d) == LLIST_OK);
+    CHECK(l.tail == old && l.heap == heap); // node taken from the pool
+    free(d);
+    llist_clear(&l);
+    CHECK(l.heap == 0 && l.pool == NULL);
+}
+
+// Checks that elements of every size are kept intact and aligned as any type 
+// of their size could need, with and without room for a handle. 
+//
+// PARAMS: 
+// arena - whether to use arena mode
+static void test_align(bool arena) {
+    llist_t l;
+    if (arena)
+        llist_init_arena(&l, 0);
+    else
+        llist_init(&l);
+
+    unsigned char d[2 * LLIST_INLINE_MAX + 1];
+    llist_handle_t h;
+    for (size_t n = 1; n <= sizeof d; n++) {
+        memset(d, (int)n, n);
+        CHECK(llist_add(&l, d, n) == LLIST_OK);
+        CHECK(llist_add_handle(&l, d, n, &h) == LLIST_OK);
+    }
+    for (const lnode_t *n = l.head; n != NULL; n = n->next) {
+        size_t want = n->size & -n->size;   // lowest set bit of the size
+        if (want > LLIST_ARENA_ALIGN || n->size > LLIST_INLINE_MAX)
+            want = LLIST_ARENA_ALIGN;
+        const unsigned char *e = lnode_data(n);
+        CHECK((uintptr_t)e % want == 0);
+        CHECK(e[0] == n->size && e[n->size - 1] == n->size);
+    }
+    CHECK(*(unsigned char *)llist_get_handle(&l, h) == sizeof d);
+    llist_clear(&l);
+}
@@ -0,0 +1,268 @@
+///////////////////////////////////////////////////////////////////////////////
+// llist_trace_test.c
+// Tests for the llist_t trace hook in C99, built together with llist.c and 
+// llist_parallel.c with LLIST_STATS and LLIST_TRACE defined. 
+//
+// Author: agent
+// Date:   17/10/2026
+///////////////////////////////////////////////////////////////////////////////
+
+#include "llist.h"
+#include "check.h"
+
+#define TEST_LEN 100                        // elements in each test list
+#define TEST_EVENTS 64                      // most events recorded
+
+// The recorder type, keeping the events seen by the hook. 
+typedef struct test_log_t {
+    llist_trace_t ev[TEST_EVENTS];          // events in order
+    size_t len;                             // events recorded
+} tlog_t;
+
+static void record(const llist_trace_t *ev, void *ctx);
+static bool paired(const tlog_t *log, int op);
+static size_t count(const tlog_t *log, int op);
+static void fill(llist_t *l);
+static void apply(void *d, size_t n, void *ctx);
+static void sum_map(void *acc, const void *d, size_t n, void *ctx);
+static void sum_combine(void *acc, const void *rhs, void *ctx);
+static void test_add_ins(void);
+static void test_early_return(void);
+static void test_freeze_thaw(void);
+static void test_parallel(void);
+static void test_unset(void);
+
+int main(void) {
+    test_add_ins();
+    test_early_return();
+    test_freeze_thaw();
+    test_parallel();
+    test_unset();
+    return check_done("llist_trace_test");
+}
+
+// Records a trace event, the hook under test. 
+//
+// PARAMS: 
+// ev  - the event
+// ctx - the recorder
+static void record(const llist_trace_t *ev, void *ctx) {
+    tlog_t *log = ctx;
+    if (log->len < TEST_EVENTS)
+        log->ev[log->len] = *ev;
+    log->len++;
+}
+
+// Returns whether the recorder holds exactly one event pair, the entry and 
+// exit of the given function. 
+//
+// PARAMS: 
+// log - the recorder
+// op  - the LLIST_OP_* of the function
+//
+// RET: 
+// True (1) if the events are one pair for op, 0 (false) otherwise. 
+static bool paired(const tlog_t *log, int op) {
+    return log->len == 2 && 
+        log->ev[0].op == op && log->ev[0].phase == LLIST_TRACE_ENTER && 
+        log->ev[1].op == op && log->ev[1].phase == LLIST_TRACE_EXIT;
+}
+
+// Returns the number of recorded events of the given function. 
+//
+// PARAMS: 
+// log - the recorder
+// op  - the LLIST_OP_* of the function
+//
+// RET: 
+// The number of events for op. 
+static size_t count(const tlog_t *log, int op) {
+    size_t ret = 0;
+    for (size_t i = 0; i < log->len && i < TEST_EVENTS; i++)
+        ret += (log->ev[i].op == op);
+    return ret;
+}
+
+// Initialises the given linked list and fills it with TEST_LEN elements, the 
+// element at index i holding i as a size_t. Call it with tracing off. 
+//
+// PARAMS: 
+// l - the linked list to fill
+static void fill(llist_t *l) {
+    llist_init(l);
+    for (size_t i = 0; i < TEST_LEN; i++)
+        CHECK(llist_add(l, &i, sizeof i) == LLIST_OK);
+}
+
+// Counts the elements visited by a parallel traversal. 
+//
+// PARAMS: 
+// d   - the element
+// n   - the size of the element
+// ctx - unused
+static void apply(void *d, size_t n, void *ctx) {
+    (void)ctx;
+    (void)n;
+    *(size_t *)d += 1;
+}
+
+// Adds an element to a sum accumulator. 
+//
+// PARAMS: 
+// acc - the accumulator
+// d   - the element
+// n   - the size of the element
+// ctx - unused
+static void sum_map(void *acc, const void *d, size_t n, void *ctx) {
+    (void)ctx;
+    (void)n;
+    size_t v = 0;
+    memcpy(&v, d, sizeof v);
+    *(size_t *)acc += v;
+}
+
+// Adds one sum accumulator to another. 
+//
+// PARAMS: 
+// acc - the accumulator to add to
+// rhs - the accumulator to add
+// ctx - unused
+static void sum_combine(void *acc, const void *rhs, void *ctx) {
+    (void)ctx;
+    *(size_t *)acc += *(const size_t *)rhs;
+}
+
+// Checks that adds and inserts are traced as themselves, including inserts 
+// at or past the end, with the index and size of the list. 
+static void test_add_ins(void) {
+    llist_t l;
+    fill(&l);
+    tlog_t log = { .len = 0 };
+    llist_set_trace(record, &log);
+    size_t v = 0;
+    CHECK(llist_add(&l, &v, sizeof v) == LLIST_OK);
+    CHECK(paired(&log, LLIST_OP_ADD));
+    CHECK(log.ev[0].index == TEST_LEN && log.ev[1].len == TEST_LEN + 1);
+
+    log.len = 0;
+    CHECK(llist_ins(&l, &v, sizeof v, l.len) == LLIST_OK);
+    CHECK(paired(&log, LLIST_OP_INS));
+    log.len = 0;
+    CHECK(llist_ins(&l, &v, sizeof v, SIZE_MAX) == LLIST_OK);
+    CHECK(paired(&log, LLIST_OP_INS) && log.ev[1].index == SIZE_MAX);
+    log.len = 0;
+    CHECK(llist_ins(&l, &v, sizeof v, TEST_LEN - 10) == LLIST_OK);
+    CHECK(paired(&log, LLIST_OP_INS) && log.ev[1].hops > 0);
+    llist_set_trace(NULL, NULL);
+    llist_clear(&l);
+}
+
+// Checks that rotations and splits which return early still emit both their 
+// entry and exit events. 
+static void test_early_return(void) {
+    llist_t l;
+    llist_t out;
+    llist_init(&l);
+    tlog_t log = { .len = 0 };
+    llist_set_trace(record, &log);
+    CHECK(llist_rotate(&l, 3) == LLIST_OK);             // empty list
+    CHECK(paired(&log, LLIST_OP_ROTATE));
+    log.len = 0;
+    CHECK(llist_split(&l, 0, &out) == LLIST_OK);        // nothing to move
+    CHECK(count(&log, LLIST_OP_SPLIT) == 2);
+    CHECK(log.ev[0].op == LLIST_OP_SPLIT && 
+        log.ev[log.len - 1].op == LLIST_OP_SPLIT && 
+        log.ev[log.len - 1].phase == LLIST_TRACE_EXIT);
+    llist_set_trace(NULL, NULL);
+
+    fill(&l);
+    llist_set_trace(record, &log);
+    log.len = 0;
+    CHECK(llist_rotate(&l, TEST_LEN) == LLIST_OK);      // full turn
+    CHECK(paired(&log, LLIST_OP_ROTATE));
+    log.len = 0;
+    CHECK(llist_rotate(&l, 1) == LLIST_OK);
+    CHECK(paired(&log, LLIST_OP_ROTATE));
+    CHECK(*(size_t *)lnode_data(l.head) == 1);
+    llist_set_trace(NULL, NULL);
+    llist_clear(&l);
+
+    llist_init_arena(&l, 0);
+    llist_set_trace(record, &log);
+    log.len = 0;
+    CHECK(llist_split(&l, 0, &out) == LLIST_MODE_ERR);  // arena list
+    CHECK(paired(&log, LLIST_OP_SPLIT));
+    llist_set_trace(NULL, NULL);
+    llist_clear(&l);
+}
+
+// Checks that freeze and thaw are traced, and that the index dropped by a 
+// change to the list does not emit a thaw of its own. 
+static void test_freeze_thaw(void) {
+    llist_t l;
+    fill(&l);
+    tlog_t log = { .len = 0 };
+    llist_set_trace(record, &log);
+    CHECK(llist_freeze(&l) == LLIST_OK && l.index != NULL);
+    CHECK(paired(&log, LLIST_OP_FREEZE));
+    log.len = 0;
+    CHECK(llist_freeze(&l) == LLIST_OK);                // already frozen
+    CHECK(paired(&log, LLIST_OP_FREEZE));
+    log.len = 0;
+    llist_thaw(&l);
+    CHECK(paired(&log, LLIST_OP_THAW) && l.index == NULL);
+
+    CHECK(llist_freeze(&l) == LLIST_OK);
+    log.len = 0;
+    size_t v = 0;
+    CHECK(llist_add(&l, &v, sizeof v) == LLIST_OK && l.index == NULL);
+    CHECK(paired(&log, LLIST_OP_ADD));
+    llist_set_trace(NULL, NULL);
+    llist_clear(&l);
+}
+
+// Checks that parallel traversals and reductions are traced once each, from 
+// the calling thread. 
+static void test_parallel(void) {
+    llist_t l;
+    fill(&l);
+    tlog_t log = { .len = 0 };
+    llist_set_trace(record, &log);
+    CHECK(llist_parallel_for_each(&l, apply, NULL, 4) == LLIST_OK);
+    CHECK(paired(&log, LLIST_OP_FOR_EACH));
+    CHECK(*(size_t *)llist_get(&l, 0) == 1);
+
+    log.len = 0;
+    size_t zero = 0;
+    size_t sum = 0;
+    llist_reducer_t r = { sum_map, sum_combine, &zero, sizeof zero, NULL };
+    CHECK(llist_parallel_reduce(&l, &r, &sum, 4) == LLIST_OK);
+    CHECK(count(&log, LLIST_OP_REDUCE) == 2);
+    CHECK(log.ev[0].phase == LLIST_TRACE_ENTER);
+    CHECK(log.ev[log.len - 1].op == LLIST_OP_REDUCE);
+    CHECK(sum == TEST_LEN * (TEST_LEN + 1) / 2);
+    llist_set_trace(NULL, NULL);
+
+    llist_t empty;
+    llist_init(&empty);
+    llist_set_trace(record, &log);
+    log.len = 0;
+    CHECK(llist_parallel_for_each(&empty, apply, NULL, 4) == LLIST_OK);
+    CHECK(paired(&log, LLIST_OP_FOR_EACH));
+    log.len = 0;
+    CHECK(llist_parallel_reduce(&empty, &r, &sum, 4) == LLIST_OK);
+    CHECK(paired(&log, LLIST_OP_REDUCE) && sum == 0);
+    llist_set_trace(NULL, NULL);
+    llist_clear(&l);
+}
+
+// Checks that no events are emitted once the hook is unset. 
+static void test_unset(void) {
+    tlog_t log = { .len = 0 };
+    llist_set_trace(record, &log);
+    llist_set_trace(NULL, NULL);
+    llist_t l;
+    fill(&l);
+    llist_clear(&l);
+    CHECK(log.len == 0);
+}
@@ -0,0 +1,131 @@
+///////////////////////////////////////////////////////////////////////////////
+// llist_typed_test.c
+// Tests for the typed linked lists of llist_typed.h in C99. 
+//
+// Author: agent
+// Date:   17/10/2026
+///////////////////////////////////////////////////////////////////////////////
+
+#include "llist_typed.h"
+#include "check.h"
+
+#define TEST_LEN 1000                       // elements in each test list
+
+// A structure element, copied by value. 
+typedef struct point_t {
+    double x;
+    double y;
+} point_t;
+
+LLIST_DEFINE(ilist, int)
+LLIST_DEFINE(plist, point_t)
+
+static bool in_order(const ilist_t *l, int first);
+static void test_add_get(void);
+static void test_ins_del(void);
+static void test_struct(void);
+static void test_args(void);
+
+int main(void) {
+    test_add_get();
+    test_ins_del();
+    test_struct();
+    test_args();
+    return check_done("llist_typed_test");
+}
+
+// Returns whether the elements of a typed list count up from the given value 
+// and are linked consistently. 
+//
+// PARAMS: 
+// l     - the typed list to check
+// first - the value of the head element
+//
+// RET: 
+// True (1) if the elements are in order, 0 (false) otherwise. 
+static bool in_order(const ilist_t *l, int first) {
+    size_t i = 0;
+    for (const ilist_node_t *n = l->head; n != NULL; n = n->next, i++) {
+        if (n->data != first + (int)i)
+            return false;
+        if ((n->prev == NULL) != (n == l->head))
+            return false;
+        if (n->next != NULL && n->next->prev != n)
+            return false;
+    }
+    return i == l->len && (l->len == 0 || l->tail->next == NULL);
+}
+
+// Checks that added elements are kept in order and found by index from 
+// either end, and that out of range indices give the last element. 
+static void test_add_get(void) {
+    ilist_t l;
+    CHECK(ilist_init(&l) == LLIST_OK);
+    for (int i = 0; i < TEST_LEN; i++)
+        CHECK(ilist_add(&l, i) == LLIST_OK);
+    CHECK(l.len == TEST_LEN && in_order(&l, 0));
+    for (size_t i = 0; i < TEST_LEN; i += 37)
+        CHECK(*ilist_get(&l, i) == (int)i);
+    CHECK(*ilist_get(&l, SIZE_MAX) == TEST_LEN - 1);
+
+    *ilist_get(&l, 5) = -5;                 // elements are writable in place
+    CHECK(*ilist_get(&l, 5) == -5);
+    ilist_clear(&l);
+    CHECK(l.len == 0 && l.head == NULL && l.tail == NULL);
+    CHECK(ilist_get(&l, 0) == NULL);
+}
+
+// Checks inserting at the head, middle and past the end, and deleting from 
+// each of them, with the deleted elements copied out. 
+static void test_ins_del(void) {
+    ilist_t l;
+    ilist_init(&l);
+    for (int i = 1; i < TEST_LEN - 1; i++)
+        ilist_add(&l, i);
+    CHECK(ilist_ins(&l, 0, 0) == LLIST_OK);
+    CHECK(ilist_ins(&l, TEST_LEN - 1, SIZE_MAX) == LLIST_OK);
+    CHECK(in_order(&l, 0));
+    CHECK(ilist_ins(&l, -1, TEST_LEN / 2) == LLIST_OK);
+    CHECK(*ilist_get(&l, TEST_LEN / 2) == -1);
+
+    int d = 0;
+    CHECK(ilist_del(&l, TEST_LEN / 2, &d) == LLIST_OK && d == -1);
+    CHECK(in_order(&l, 0));
+    CHECK(ilist_del(&l, 0, &d) == LLIST_OK && d == 0);
+    CHECK(ilist_del(&l, SIZE_MAX, &d) == LLIST_OK && d == TEST_LEN - 1);
+    CHECK(ilist_del(&l, 0, NULL) == LLIST_OK);
+    CHECK(l.len == TEST_LEN - 3 && in_order(&l, 2));
+
+    while (l.len > 0)
+        CHECK(ilist_del(&l, l.len / 2, NULL) == LLIST_OK);
+    CHECK(l.head == NULL && l.tail == NULL);
+    CHECK(ilist_del(&l, 0, &d) == LLIST_NULL_ERR);
+    ilist_clear(&l);
+}
+
+// Checks that structure elements are copied by value. 
+static void test_struct(void) {
+    plist_t l;
+    plist_init(&l);
+    point_t p = { 1.5, -2.5 };
+    CHECK(plist_add(&l, p) == LLIST_OK);
+    p.x = 3.0;
+    CHECK(plist_ins(&l, p, 0) == LLIST_OK);
+    CHECK(plist_get(&l, 0)->x == 3.0 && plist_get(&l, 1)->x == 1.5);
+    CHECK(plist_get(&l, 1)->y == -2.5);
+
+    point_t out = { 0, 0 };
+    CHECK(plist_del(&l, 1, &out) == LLIST_OK);
+    CHECK(out.x == 1.5 && out.y == -2.5 && l.len == 1);
+    plist_clear(&l);
+}
+
+// Checks that invalid arguments are rejected. 
+static void test_args(void) {
+    CHECK(ilist_init(NULL) == LLIST_NULL_ERR);
+    CHECK(ilist_add(NULL, 1) == LLIST_NULL_ERR);
+    CHECK(ilist_ins(NULL, 1, 0) == LLIST_NULL_ERR);
+    CHECK(ilist_get(NULL, 0) == NULL);
+    CHECK(ilist_del(NULL, 0, NULL) == LLIST_NULL_ERR);
+    ilist_clear(NULL);
+}
@@ -0,0 +1,243 @@
+///////////////////////////////////////////////////////////////////////////////
+// pllist_test.c
+// Tests for pllist_t in C99 and POSIX. 
+//
+// Author: agent
+// Date:   17/10/2026
+///////////////////////////////////////////////////////////////////////////////
+
+#define _POSIX_C_SOURCE 200809L
+#include "pllist.h"
+#include "check.h"
+#include <stddef.h>
+#include <unistd.h>
+
+#define TEST_LEN 1000                       // elements in each test list
+#define TEST_BIG 4096                       // size of a large element
+
+static void make_path(char *path);
+static void fill(pllist_t *l, char *path);
+static uint64_t header(const char *path, size_t field);
+static int corrupt(const char *path, size_t field, uint64_t v);
+static void test_add_get(void);
+static void test_reopen(void);
+static void test_reuse(void);
+static void test_grow(void);
+static void test_bad_header(void);
+static void test_bad_link(void);
+
+int main(void) {
+    test_add_get();
+    test_reopen();
+    test_reuse();
+    test_grow();
+    test_bad_header();
+    test_bad_link();
+    return check_done("pllist_test");
+}
+
+// Creates an empty temporary file and stores its path. 
+//
+// PARAMS: 
+// path - where to store the path, at least 32 bytes
+static void make_path(char *path) {
+    strcpy(path, "/tmp/pllist_testXXXXXX");
+    int fd = mkstemp(path);
+    CHECK(fd >= 0);
+    if (fd >= 0)
+        close(fd);
+}
+
+// Opens a new persistent linked list in a temporary file and fills it with 
+// TEST_LEN elements, the element at index i holding i as a size_t. 
+//
+// PARAMS: 
+// l    - the persistent linked list to fill
+// path - where to store the path of its file, at least 32 bytes
+static void fill(pllist_t *l, char *path) {
+    make_path(path);
+    CHECK(pllist_open(l, path) == LLIST_OK && pllist_len(l) == 0);
+    for (size_t i = 0; i < TEST_LEN; i++)
+        CHECK(pllist_add(l, &i, sizeof i) == LLIST_OK);
+}
+
+// Returns a field of the header stored in the given file. 
+//
+// PARAMS: 
+// path  - the path of the file
+// field - the offset of the field in pheader_t
+//
+// RET: 
+// The value of the field, or 0 if it could not be read. 
+static uint64_t header(const char *path, size_t field) {
+    uint64_t v = 0;
+    FILE *f = fopen(path, "rb");
+    if (f != NULL) {
+        if (fseek(f, (long)field, SEEK_SET) != 0 || 
+            fread(&v, sizeof v, 1, f) != 1)
+            v = 0;
+        fclose(f);
+    }
+    return v;
+}
+
+// Overwrites a field of the header stored in the given file. 
+//
+// PARAMS: 
+// path  - the path of the file
+// field - the offset of the field in pheader_t
+// v     - the value to store
+//
+// RET: 
+// Zero on success, non-zero on error. 
+static int corrupt(const char *path, size_t field, uint64_t v) {
+    FILE *f = fopen(path, "r+b");
+    if (f == NULL)
+        return LLIST_IO_ERR;
+    int ret = (fseek(f, (long)field, SEEK_SET) == 0 && 
+        fwrite(&v, sizeof v, 1, f) == 1) ? LLIST_OK : LLIST_IO_ERR;
+    return (fclose(f) == 0) ? ret : LLIST_IO_ERR;
+}
+
+// Checks adding, inserting, finding and deleting elements, with out of range 
+// indices taking the last element. 
+static void test_add_get(void) {
+    char path[32];
+    pllist_t l;
+    fill(&l, path);
+    CHECK(pllist_len(&l) == TEST_LEN);
+    for (size_t i = 0; i < TEST_LEN; i += 37)
+        CHECK(*(size_t *)pllist_get(&l, i) == i);
+    CHECK(*(size_t *)pllist_get(&l, SIZE_MAX) == TEST_LEN - 1);
+
+    size_t v = TEST_LEN;
+    CHECK(pllist_ins(&l, &v, sizeof v, 0) == LLIST_OK);
+    CHECK(pllist_ins(&l, &v, sizeof v, TEST_LEN / 2) == LLIST_OK);
+    CHECK(*(size_t *)pllist_get(&l, 0) == TEST_LEN);
+    CHECK(*(size_t *)pllist_get(&l, TEST_LEN / 2) == TEST_LEN);
+    CHECK(*(size_t *)pllist_get(&l, TEST_LEN / 2 + 1) == TEST_LEN / 2 - 1);
+    CHECK(pllist_del(&l, TEST_LEN / 2) == LLIST_OK);
+    CHECK(pllist_del(&l, 0) == LLIST_OK);
+    CHECK(pllist_del(&l, SIZE_MAX) == LLIST_OK);
+    CHECK(pllist_len(&l) == TEST_LEN - 1);
+    for (size_t i = 0; i < TEST_LEN - 1; i += 37)
+        CHECK(*(size_t *)pllist_get(&l, i) == i);
+
+    pllist_clear(&l);
+    CHECK(pllist_len(&l) == 0 && pllist_get(&l, 0) == NULL);
+    CHECK(pllist_del(&l, 0) == LLIST_NULL_ERR);
+    CHECK(pllist_add(&l, NULL, sizeof v) == LLIST_NULL_ERR);
+    pllist_close(&l);
+    unlink(path);
+}
+
+// Checks that flushed elements are found again after the file is reopened. 
+static void test_reopen(void) {
+    char path[32];
+    pllist_t l;
+    fill(&l, path);
+    CHECK(pllist_flush(&l) == LLIST_OK);
+    pllist_close(&l);
+
+    CHECK(pllist_open(&l, path) == LLIST_OK);
+    CHECK(pllist_len(&l) == TEST_LEN);
+    for (size_t i = 0; i < TEST_LEN; i++)
+        CHECK(*(size_t *)pllist_get(&l, i) == i);
+    pllist_close(&l);
+    unlink(path);
+}
+
+// Checks that deleted nodes are reused instead of growing the used space. 
+static void test_reuse(void) {
+    char path[32];
+    pllist_t l;
+    fill(&l, path);
+    pllist_close(&l);
+    uint64_t used = header(path, offsetof(pheader_t, used));
+    CHECK(used > sizeof(pheader_t));
+
+    CHECK(pllist_open(&l, path) == LLIST_OK);
+    for (size_t i = 0; i < TEST_LEN / 2; i++)
+        CHECK(pllist_del(&l, i) == LLIST_OK);
+    for (size_t i = 0; i < TEST_LEN / 2; i++)
+        CHECK(pllist_add(&l, &i, sizeof i) == LLIST_OK);
+    CHECK(pllist_len(&l) == TEST_LEN);
+    pllist_close(&l);
+    CHECK(header(path, offsetof(pheader_t, used)) == used);
+    unlink(path);
+}
+
+// Checks that the file grows past its initial size with elements intact. 
+static void test_grow(void) {
+    char path[32];
+    make_path(path);
+    pllist_t l;
+    CHECK(pllist_open(&l, path) == LLIST_OK);
+    unsigned char d[TEST_BIG];
+    size_t n = 2 * PLLIST_INIT_CAP / TEST_BIG;
+    for (size_t i = 0; i < n; i++) {
+        memset(d, (int)(i & 0xff), sizeof d);
+        CHECK(pllist_add(&l, d, sizeof d) == LLIST_OK);
+    }
+    CHECK(l.cap > PLLIST_INIT_CAP && pllist_len(&l) == n);
+    for (size_t i = 0; i < n; i += 17) {
+        const unsigned char *e = pllist_get(&l, i);
+        CHECK(e != NULL && e[0] == (i & 0xff) && e[TEST_BIG - 1] == e[0]);
+    }
+    pllist_close(&l);
+    unlink(path);
+}
+
+// Checks that files whose header names offsets outside the allocated space, 
+// inside the header or off the node alignment, or whose magic is wrong, are 
+// rejected when opened. 
+static void test_bad_header(void) {
+    char path[32];
+    pllist_t l;
+    fill(&l, path);
+    CHECK(pllist_del(&l, TEST_LEN / 2) == LLIST_OK);    // free list not empty
+    pllist_close(&l);
+    uint64_t used = header(path, offsetof(pheader_t, used));
+
+    size_t fields[] = { offsetof(pheader_t, head), offsetof(pheader_t, tail), 
+        offsetof(pheader_t, free) };
+    uint64_t bad[] = { 8, used, used + 4096, sizeof(pheader_t) + 8 };
+    for (size_t f = 0; f < sizeof fields / sizeof *fields; f++) {
+        uint64_t v = header(path, fields[f]);
+        for (size_t b = 0; b < sizeof bad / sizeof *bad; b++) {
+            CHECK(corrupt(path, fields[f], bad[b]) == LLIST_OK);
+            CHECK(pllist_open(&l, path) == LLIST_IO_ERR);
+        }
+        CHECK(corrupt(path, fields[f], v) == LLIST_OK);
+        CHECK(pllist_open(&l, path) == LLIST_OK);
+        pllist_close(&l);
+    }
+
+    CHECK(corrupt(path, offsetof(pheader_t, used), 8) == LLIST_OK);
+    CHECK(pllist_open(&l, path) == LLIST_IO_ERR);
+    CHECK(corrupt(path, offsetof(pheader_t, used), used) == LLIST_OK);
+    CHECK(corrupt(path, offsetof(pheader_t, len), 0) == LLIST_OK);
+    CHECK(pllist_open(&l, path) == LLIST_IO_ERR);       // len disagrees
+    CHECK(corrupt(path, offsetof(pheader_t, len), TEST_LEN - 1) == LLIST_OK);
+    CHECK(corrupt(path, offsetof(pheader_t, magic), 0) == LLIST_OK);
+    CHECK(pllist_open(&l, path) == LLIST_IO_ERR);
+    unlink(path);
+}
+
+// Checks that a corrupt link inside the list is reported by the walks that 
+// follow it instead of being dereferenced. 
+static void test_bad_link(void) {
+    char path[32];
+    pllist_t l;
+    fill(&l, path);
+    pheader_t *h = (pheader_t *)l.map;
+    plnode_t *head = (plnode_t *)(l.map + h->head);
+    head->next = h->used + 4096;
+    CHECK(pllist_get(&l, 0) != NULL);
+    CHECK(pllist_get(&l, 1) == NULL);
+    CHECK(pllist_del(&l, 0) == LLIST_IO_ERR);
+    CHECK(pllist_ins(&l, &l, sizeof l, 1) == LLIST_IO_ERR);
+    CHECK(pllist_len(&l) == TEST_LEN);
+    pllist_close(&l);
+    unlink(path);
+}
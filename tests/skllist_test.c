@@ -0,0 +1,222 @@
+///////////////////////////////////////////////////////////////////////////////
+// skllist_test.c
+// Tests for skllist_t in C99. 
+//
+// Author: agent
+// Date:   17/10/2026
+///////////////////////////////////////////////////////////////////////////////
+
+#include "skllist.h"
+#include "check.h"
+
+#define TEST_LEN 5000                       // elements in each test list
+#define TEST_KEYS 500                       // distinct keys, so keys repeat
+
+// The test element type, ordered by key only. 
+typedef struct test_elem_t {
+    size_t key;                             // the ordering key
+    size_t seq;                             // the order of insertion
+} telem_t;
+
+static int elem_cmp(const void *a, const void *b);
+static size_t next_key(uint64_t *s);
+static const void *node_data(const sknode_t *n);
+static bool well_formed(const skllist_t *l);
+static bool drains_sorted(skllist_t *l, size_t len);
+static void test_insert(void);
+static void test_merge(void);
+static void test_sizes(void);
+static void test_args(void);
+
+int main(void) {
+    test_insert();
+    test_merge();
+    test_sizes();
+    test_args();
+    return check_done("skllist_test");
+}
+
+// Compares two test elements by key. 
+//
+// PARAMS: 
+// a - the first element
+// b - the second element
+//
+// RET: 
+// Less than, equal to or greater than zero as a is ordered before, with or 
+// after b. 
+static int elem_cmp(const void *a, const void *b) {
+    size_t x = ((const telem_t *)a)->key;
+    size_t y = ((const telem_t *)b)->key;
+    return (x > y) - (x < y);
+}
+
+// Returns a pseudo random key below TEST_KEYS. 
+//
+// PARAMS: 
+// s - the generator state, updated
+//
+// RET: 
+// The key. 
+static size_t next_key(uint64_t *s) {
+    *s ^= *s << 13;
+    *s ^= *s >> 7;
+    *s ^= *s << 17;
+    return (size_t)(*s % TEST_KEYS);
+}
+
+// Returns the element stored after the links of a node. 
+//
+// PARAMS: 
+// n - the node holding the element
+//
+// RET: 
+// The element in the node. 
+static const void *node_data(const sknode_t *n) {
+    return n->next + n->level;
+}
+
+// Returns whether every level of a sorted skip list is in order, only links 
+// nodes tall enough for it, and skips through the nodes of the level below. 
+//
+// PARAMS: 
+// l - the sorted skip list to check
+//
+// RET: 
+// True (1) if the list is well formed, 0 (false) otherwise. 
+static bool well_formed(const skllist_t *l) {
+    size_t len = 0;
+    for (const sknode_t *n = l->head[0]; n != NULL; n = n->next[0])
+        len++;
+    if (len != l->len || l->level < 1 || l->level > SKLLIST_LEVELS)
+        return false;
+    for (size_t i = 0; i < SKLLIST_LEVELS; i++) {
+        if (i >= l->level && l->head[i] != NULL)
+            return false;
+        const sknode_t *below = (i > 0) ? l->head[i - 1] : NULL;
+        for (const sknode_t *n = l->head[i]; n != NULL; n = n->next[i]) {
+            if (n->level <= i)
+                return false;
+            if (n->next[i] != NULL && 
+                l->cmp(node_data(n->next[i]), node_data(n)) < 0)
+                return false;
+            while (i > 0 && below != NULL && below != n)
+                below = below->next[i - 1];
+            if (i > 0 && below == NULL)
+                return false;
+        }
+    }
+    return true;
+}
+
+// Pops every element of a sorted skip list made of test elements, checking 
+// that keys never go down and equal keys come out in insertion order. 
+//
+// PARAMS: 
+// l   - the sorted skip list to drain
+// len - the expected size
+//
+// RET: 
+// True (1) if the elements came out in order, 0 (false) otherwise. 
+static bool drains_sorted(skllist_t *l, size_t len) {
+    bool ret = (l->len == len);
+    telem_t last = { 0, 0 };
+    for (size_t i = 0; i < len && ret; i++) {
+        const telem_t *min = skllist_min(l);
+        telem_t *e = skllist_pop_min(l);
+        ret = (e != NULL && min != NULL && min->key == e->key);
+        if (ret && i > 0) {
+            ret = (last.key < e->key || 
+                (last.key == e->key && last.seq < e->seq));
+        }
+        if (e != NULL)
+            last = *e;
+        free(e);
+    }
+    return ret && l->len == 0 && skllist_min(l) == NULL;
+}
+
+// Checks that inserted elements are linked well formed and come out sorted, 
+// with equal elements in insertion order. 
+static void test_insert(void) {
+    skllist_t l;
+    CHECK(skllist_init(&l, elem_cmp) == LLIST_OK);
+    uint64_t s = 88172645463325252ull;
+    for (size_t round = 0; round < 2; round++) {
+        for (size_t i = 0; i < TEST_LEN; i++) {
+            telem_t e = { next_key(&s), i };
+            CHECK(skllist_insert(&l, &e, sizeof e) == LLIST_OK);
+        }
+        CHECK(well_formed(&l) && l.level > 1);
+        CHECK(drains_sorted(&l, TEST_LEN));
+        CHECK(well_formed(&l) && l.level == 1);
+    }
+    skllist_clear(&l);
+}
+
+// Checks that merging a sorted run gives the same order as inserting each 
+// element, with run elements after equal elements already in the list. 
+static void test_merge(void) {
+    skllist_t l;
+    CHECK(skllist_init(&l, elem_cmp) == LLIST_OK);
+    uint64_t s = 2463534242ull;
+    for (size_t i = 0; i < TEST_LEN; i++) {
+        telem_t e = { next_key(&s), i };
+        CHECK(skllist_insert(&l, &e, sizeof e) == LLIST_OK);
+    }
+
+    llist_t run;
+    llist_init(&run);
+    for (size_t k = 0; k < TEST_KEYS; k += 3) {
+        for (size_t j = 0; j < 4; j++) {
+            telem_t e = { k, TEST_LEN + k * 4 + j };
+            CHECK(llist_add(&run, &e, sizeof e) == LLIST_OK);
+        }
+    }
+    CHECK(skllist_merge(&l, &run) == LLIST_OK && well_formed(&l));
+    CHECK(drains_sorted(&l, TEST_LEN + run.len));
+
+    CHECK(skllist_merge(&l, &run) == LLIST_OK);     // into an empty list
+    CHECK(well_formed(&l) && drains_sorted(&l, run.len));
+    llist_clear(&run);
+    CHECK(skllist_merge(&l, &run) == LLIST_OK && l.len == 0);
+    skllist_clear(&l);
+}
+
+// Checks that elements of different sizes keep their sizes and bytes, and 
+// that clearing frees the rest. 
+static void test_sizes(void) {
+    skllist_t l;
+    CHECK(skllist_init(&l, elem_cmp) == LLIST_OK);
+    unsigned char d[sizeof(telem_t) + 64];
+    for (size_t i = 0; i < 64; i++) {
+        telem_t e = { 63 - i, i };
+        memset(d, (int)i, sizeof d);
+        memcpy(d, &e, sizeof e);
+        CHECK(skllist_insert(&l, d, sizeof e + i + 1) == LLIST_OK);
+    }
+    for (size_t i = 0; i < 32; i++) {
+        unsigned char *e = skllist_pop_min(&l);
+        CHECK(e != NULL && ((telem_t *)e)->key == i);
+        CHECK(e[sizeof(telem_t) + 63 - i] == 63 - i);
+        free(e);
+    }
+    CHECK(l.len == 32 && well_formed(&l));
+    skllist_clear(&l);
+    CHECK(l.len == 0 && l.head[0] == NULL && skllist_pop_min(&l) == NULL);
+}
+
+// Checks that missing lists, functions and elements are rejected. 
+static void test_args(void) {
+    skllist_t l;
+    telem_t e = { 0, 0 };
+    CHECK(skllist_init(NULL, elem_cmp) == LLIST_NULL_ERR);
+    CHECK(skllist_init(&l, NULL) == LLIST_NULL_ERR);
+    CHECK(skllist_init(&l, elem_cmp) == LLIST_OK);
+    CHECK(skllist_insert(NULL, &e, sizeof e) == LLIST_NULL_ERR);
+    CHECK(skllist_insert(&l, NULL, sizeof e) == LLIST_NULL_ERR);
+    CHECK(skllist_insert(&l, &e, 0) == LLIST_NULL_ERR);
+    CHECK(skllist_merge(&l, NULL) == LLIST_NULL_ERR);
+    CHECK(skllist_min(NULL) == NULL && skllist_pop_min(NULL) == NULL);
+    skllist_clear(NULL);
+}
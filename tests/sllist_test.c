@@ -0,0 +1,94 @@
+///////////////////////////////////////////////////////////////////////////////
+// sllist_test.c
+// Tests for sllist_t in C99. 
+//
+// Author: agent
+// Date:   17/10/2026
+///////////////////////////////////////////////////////////////////////////////
+
+#include "sllist.h"
+#include "check.h"
+
+#define TEST_LEN 1000                       // elements in each test list
+#define TEST_MAX 40                         // largest test element
+
+static void sum_fn(void *d, size_t n, void *ctx);
+static void test_add_pop(void);
+static void test_foreach(void);
+static void test_args(void);
+
+int main(void) {
+    test_add_pop();
+    test_foreach();
+    test_args();
+    return check_done("sllist_test");
+}
+
+// Adds the first byte and the size of an element to a running total. 
+//
+// PARAMS: 
+// d   - the element
+// n   - the size of the element
+// ctx - the running total, a size_t
+static void sum_fn(void *d, size_t n, void *ctx) {
+    *(size_t *)ctx += *(unsigned char *)d + n;
+}
+
+// Checks that popping hands back the head nodes in order, with their sizes, 
+// and that the list can be refilled once emptied. 
+static void test_add_pop(void) {
+    sllist_t l;
+    CHECK(sllist_init(&l) == LLIST_OK);
+    unsigned char d[TEST_MAX];
+    for (int round = 0; round < 2; round++) {
+        for (size_t i = 0; i < TEST_LEN; i++) {
+            memset(d, (int)(i & 0xff), sizeof d);
+            CHECK(sllist_add(&l, d, i % sizeof d + 1) == LLIST_OK);
+        }
+        CHECK(l.len == TEST_LEN);
+        for (size_t i = 0; i < TEST_LEN; i++) {
+            slnode_t *n = sllist_pop(&l);
+            CHECK(n != NULL && n->next == NULL);
+            CHECK(n->size == i % sizeof d + 1);
+            CHECK(n->data[0] == (i & 0xff) && n->data[n->size - 1] == 
+                (i & 0xff));
+            free(n);
+        }
+        CHECK(l.len == 0 && l.head == NULL && l.tail == NULL);
+        CHECK(sllist_pop(&l) == NULL);
+    }
+    sllist_clear(&l);
+}
+
+// Checks that foreach visits every element in order with its size. 
+static void test_foreach(void) {
+    sllist_t l;
+    sllist_init(&l);
+    size_t want = 0;
+    for (unsigned char i = 1; i <= 100; i++) {
+        sllist_add(&l, &i, sizeof i);
+        want += i + sizeof i;
+    }
+    size_t sum = 0;
+    sllist_foreach(&l, sum_fn, &sum);
+    CHECK(sum == want);
+    sllist_clear(&l);
+    CHECK(l.len == 0 && l.head == NULL && l.tail == NULL);
+    sum = 0;
+    sllist_foreach(&l, sum_fn, &sum);
+    CHECK(sum == 0);
+}
+
+// Checks that invalid arguments are rejected. 
+static void test_args(void) {
+    sllist_t l;
+    size_t v = 1;
+    CHECK(sllist_init(NULL) == LLIST_NULL_ERR);
+    sllist_init(&l);
+    CHECK(sllist_add(NULL, &v, sizeof v) == LLIST_NULL_ERR);
+    CHECK(sllist_add(&l, NULL, sizeof v) == LLIST_NULL_ERR);
+    CHECK(sllist_add(&l, &v, 0) == LLIST_NULL_ERR);
+    CHECK(sllist_pop(NULL) == NULL);
+    sllist_foreach(&l, NULL, NULL);
+    sllist_clear(NULL);
+}
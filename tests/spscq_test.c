@@ -0,0 +1,154 @@
+///////////////////////////////////////////////////////////////////////////////
+// spscq_test.c
+// Tests for spscq_t in C11 and POSIX threads. 
+//
+// Author: agent
+// Date:   17/10/2026
+///////////////////////////////////////////////////////////////////////////////
+
+#include "spscq.h"
+#include "check.h"
+#include <stdint.h>
+#include <pthread.h>
+
+#define TEST_LEN 1000                       // elements queued at once
+#define TEST_ITEMS 1000000                  // elements passed between threads
+
+static size_t nodes(const spscq_t *q);
+static void *produce(void *arg);
+static void test_order(void);
+static void test_reuse(void);
+static void test_reserve(void);
+static void test_threads(void);
+static void test_args(void);
+
+int main(void) {
+    test_order();
+    test_reuse();
+    test_reserve();
+    test_threads();
+    test_args();
+    return check_done("spscq_test");
+}
+
+// Returns the number of nodes owned by the given queue, which are all linked 
+// from the oldest. Neither side may use the queue at the same time. 
+//
+// PARAMS: 
+// q - the queue to measure
+//
+// RET: 
+// The number of nodes. 
+static size_t nodes(const spscq_t *q) {
+    size_t ret = 0;
+    for (const spscnode_t *n = q->first; n != NULL; n = atomic_load(&n->next))
+        ret++;
+    return ret;
+}
+
+// Pushes TEST_ITEMS counting values from 1 as pointers, spinning while a 
+// push fails. 
+//
+// PARAMS: 
+// arg - the queue to push to
+//
+// RET: 
+// NULL. 
+static void *produce(void *arg) {
+    spscq_t *q = arg;
+    for (uintptr_t i = 1; i <= TEST_ITEMS; i++) {
+        while (spscq_push(q, (void *)i) != LLIST_OK)
+            ;
+    }
+    return NULL;
+}
+
+// Checks that elements come out in the order they went in, and that an empty 
+// queue pops nothing. 
+static void test_order(void) {
+    spscq_t q;
+    CHECK(spscq_init(&q) == LLIST_OK);
+    void *d = NULL;
+    CHECK(!spscq_pop(&q, &d) && d == NULL);
+    int v[TEST_LEN];
+    for (int round = 0; round < 2; round++) {
+        for (size_t i = 0; i < TEST_LEN; i++)
+            CHECK(spscq_push(&q, &v[i]) == LLIST_OK);
+        for (size_t i = 0; i < TEST_LEN; i++)
+            CHECK(spscq_pop(&q, &d) && d == &v[i]);
+        CHECK(!spscq_pop(&q, &d));
+    }
+    CHECK(spscq_push(&q, NULL) == LLIST_OK);    // null elements are allowed
+    d = &v[0];
+    CHECK(spscq_pop(&q, &d) && d == NULL);
+    spscq_clear(&q);
+    CHECK(q.first == NULL && q.head == NULL);
+}
+
+// Checks that a queue stops allocating once it has reached its working size, 
+// reusing the nodes the consumer has moved past. 
+static void test_reuse(void) {
+    spscq_t q;
+    CHECK(spscq_init(&q) == LLIST_OK);
+    int v[TEST_LEN];
+    for (size_t i = 0; i < TEST_LEN; i++)
+        CHECK(spscq_push(&q, &v[i]) == LLIST_OK);
+    size_t working = nodes(&q);
+    CHECK(working == TEST_LEN + 1);
+
+    void *d = NULL;
+    for (size_t k = 0; k < 10 * TEST_LEN; k++) {
+        CHECK(spscq_pop(&q, &d) && d == &v[k % TEST_LEN]);
+        CHECK(spscq_push(&q, &v[k % TEST_LEN]) == LLIST_OK);
+    }
+    CHECK(nodes(&q) == working);
+    spscq_clear(&q);
+}
+
+// Checks that reserved nodes are used before allocating new ones. 
+static void test_reserve(void) {
+    spscq_t q;
+    CHECK(spscq_init(&q) == LLIST_OK);
+    CHECK(spscq_reserve(&q, TEST_LEN) == LLIST_OK);
+    CHECK(nodes(&q) == TEST_LEN + 1);
+    int v[TEST_LEN + 1];
+    for (size_t i = 0; i < TEST_LEN; i++)
+        CHECK(spscq_push(&q, &v[i]) == LLIST_OK);
+    CHECK(nodes(&q) == TEST_LEN + 1);
+    CHECK(spscq_push(&q, &v[TEST_LEN]) == LLIST_OK);
+    CHECK(nodes(&q) == TEST_LEN + 2);
+
+    void *d = NULL;
+    for (size_t i = 0; i <= TEST_LEN; i++)
+        CHECK(spscq_pop(&q, &d) && d == &v[i]);
+    CHECK(spscq_reserve(&q, 0) == LLIST_OK && nodes(&q) == TEST_LEN + 2);
+    spscq_clear(&q);
+}
+
+// Checks that every element pushed by a producer thread reaches the consumer 
+// once and in order. 
+static void test_threads(void) {
+    spscq_t q;
+    CHECK(spscq_init(&q) == LLIST_OK);
+    pthread_t tid;
+    CHECK(pthread_create(&tid, NULL, produce, &q) == 0);
+
+    size_t bad = 0;
+    uintptr_t want = 1;
+    while (want <= TEST_ITEMS) {
+        void *d = NULL;
+        if (spscq_pop(&q, &d))
+            bad += ((uintptr_t)d != want++);
+    }
+    pthread_join(tid, NULL);
+    void *d = NULL;
+    CHECK(bad == 0 && !spscq_pop(&q, &d));
+    spscq_clear(&q);
+}
+
+// Checks that missing queues are rejected. 
+static void test_args(void) {
+    CHECK(spscq_init(NULL) == LLIST_NULL_ERR);
+    CHECK(spscq_reserve(NULL, 1) == LLIST_NULL_ERR);
+    spscq_clear(NULL);
+}
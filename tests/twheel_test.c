@@ -0,0 +1,198 @@
+///////////////////////////////////////////////////////////////////////////////
+// twheel_test.c
+// Tests for twheel_t in C99. 
+//
+// Author: agent
+// Date:   17/10/2026
+///////////////////////////////////////////////////////////////////////////////
+
+#include "twheel.h"
+#include "check.h"
+
+#define TEST_LEN 5000                       // timers in each test wheel
+#define TEST_SPAN ((uint64_t)1 << 20)       // longest delay, three levels
+
+// The firing record type, shared by the timers of a test. 
+typedef struct test_record_t {
+    twheel_t *w;                            // the wheel firing the timers
+    ttimer_t *victim;                       // timer to cancel, or NULL
+    size_t fired;                           // timers fired
+    size_t late;                            // timers fired off their tick
+    size_t again;                           // reschedules left for repeat
+    uint64_t last;                          // tick of the last firing
+} trecord_t;
+
+static uint64_t next_delay(uint64_t *s);
+static void on_fire(ttimer_t *t, void *ctx);
+static void on_repeat(ttimer_t *t, void *ctx);
+static void on_cancel(ttimer_t *t, void *ctx);
+static void test_fire(void);
+static void test_cancel(void);
+static void test_callbacks(void);
+static void test_far(void);
+static void test_args(void);
+
+int main(void) {
+    test_fire();
+    test_cancel();
+    test_callbacks();
+    test_far();
+    test_args();
+    return check_done("twheel_test");
+}
+
+// Returns a pseudo random delay between 1 and TEST_SPAN. 
+//
+// PARAMS: 
+// s - the generator state, updated
+//
+// RET: 
+// The delay. 
+static uint64_t next_delay(uint64_t *s) {
+    *s ^= *s << 13;
+    *s ^= *s >> 7;
+    *s ^= *s << 17;
+    return *s % TEST_SPAN + 1;
+}
+
+// Records a firing, noting timers fired off their tick or out of order. 
+//
+// PARAMS: 
+// t   - the timer that fired
+// ctx - the firing record
+static void on_fire(ttimer_t *t, void *ctx) {
+    trecord_t *r = ctx;
+    r->late += (t->expires != r->w->now || r->w->now < r->last);
+    r->last = r->w->now;
+    r->fired++;
+}
+
+// Records a firing, then schedules the timer again one tick later while 
+// reschedules are left. 
+//
+// PARAMS: 
+// t   - the timer that fired
+// ctx - the firing record
+static void on_repeat(ttimer_t *t, void *ctx) {
+    trecord_t *r = ctx;
+    on_fire(t, ctx);
+    if (r->again > 0) {
+        r->again--;
+        CHECK(twheel_schedule(r->w, t, 1) == LLIST_OK);
+    }
+}
+
+// Records a firing, then cancels the victim timer. 
+//
+// PARAMS: 
+// t   - the timer that fired
+// ctx - the firing record
+static void on_cancel(ttimer_t *t, void *ctx) {
+    trecord_t *r = ctx;
+    on_fire(t, ctx);
+    twheel_cancel(r->w, r->victim);
+}
+
+// Checks that timers spread over three levels each fire once on their tick, 
+// in order, however the wheel is advanced. 
+static void test_fire(void) {
+    static ttimer_t t[TEST_LEN];
+    twheel_t w;
+    CHECK(twheel_init(&w, 12345) == LLIST_OK);
+    trecord_t r = { &w, NULL, 0, 0, 0, 0 };
+    uint64_t s = 88172645463325252ull;
+    for (size_t i = 0; i < TEST_LEN; i++) {
+        ttimer_init(&t[i], on_fire, &r);
+        CHECK(twheel_schedule(&w, &t[i], next_delay(&s)) == LLIST_OK);
+    }
+    CHECK(w.len == TEST_LEN);
+
+    size_t fired = 0;
+    for (uint64_t k = 1; fired < TEST_LEN && w.now < 12345 + TEST_SPAN; k++)
+        fired += twheel_advance(&w, k % 1000);
+    CHECK(fired == TEST_LEN && r.fired == TEST_LEN && r.late == 0);
+    CHECK(w.len == 0 && twheel_advance(&w, TEST_SPAN) == 0);
+    for (size_t i = 0; i < TEST_LEN; i++)
+        CHECK(!ttimer_pending(&t[i]));
+}
+
+// Checks that cancelled timers never fire, and rescheduled timers only fire 
+// on their new tick. 
+static void test_cancel(void) {
+    static ttimer_t t[TEST_LEN];
+    twheel_t w;
+    CHECK(twheel_init(&w, 0) == LLIST_OK);
+    trecord_t r = { &w, NULL, 0, 0, 0, 0 };
+    uint64_t s = 2463534242ull;
+    for (size_t i = 0; i < TEST_LEN; i++) {
+        ttimer_init(&t[i], on_fire, &r);
+        CHECK(twheel_schedule(&w, &t[i], next_delay(&s)) == LLIST_OK);
+    }
+    for (size_t i = 0; i < TEST_LEN; i += 2) {
+        twheel_cancel(&w, &t[i]);
+        CHECK(!ttimer_pending(&t[i]));
+        twheel_cancel(&w, &t[i]);           // cancelling twice is harmless
+    }
+    for (size_t i = 1; i < TEST_LEN; i += 4)
+        CHECK(twheel_schedule(&w, &t[i], next_delay(&s)) == LLIST_OK);
+    CHECK(w.len == TEST_LEN / 2);
+
+    CHECK(twheel_advance(&w, TEST_SPAN) == TEST_LEN / 2);
+    CHECK(r.fired == TEST_LEN / 2 && r.late == 0 && w.len == 0);
+}
+
+// Checks that timer functions may reschedule their own timer and cancel a 
+// timer due on the same tick. 
+static void test_callbacks(void) {
+    twheel_t w;
+    CHECK(twheel_init(&w, 0) == LLIST_OK);
+    trecord_t r = { &w, NULL, 0, 0, 300, 0 };
+    ttimer_t repeat;
+    ttimer_init(&repeat, on_repeat, &r);
+    CHECK(twheel_schedule(&w, &repeat, 0) == LLIST_OK);     // taken as 1
+    CHECK(twheel_advance(&w, 1000) == 301 && r.late == 0);
+    CHECK(r.last == 301 && !ttimer_pending(&repeat));
+
+    ttimer_t killer;
+    ttimer_t victim;
+    r.fired = 0;
+    r.last = w.now;
+    ttimer_init(&killer, on_cancel, &r);
+    ttimer_init(&victim, on_fire, &r);
+    r.victim = &victim;
+    CHECK(twheel_schedule(&w, &killer, 700) == LLIST_OK);
+    CHECK(twheel_schedule(&w, &victim, 700) == LLIST_OK);
+    CHECK(twheel_advance(&w, 700) == 1 && r.fired == 1);
+    CHECK(!ttimer_pending(&victim) && w.len == 0);
+}
+
+// Checks that a timer beyond the span of every level stays pending until it 
+// is cancelled. 
+static void test_far(void) {
+    twheel_t w;
+    CHECK(twheel_init(&w, 7) == LLIST_OK);
+    trecord_t r = { &w, NULL, 0, 0, 0, 0 };
+    ttimer_t t;
+    ttimer_init(&t, on_fire, &r);
+    CHECK(twheel_schedule(&w, &t, (uint64_t)1 << 40) == LLIST_OK);
+    CHECK(t.expires == 7 + ((uint64_t)1 << 40) && ttimer_pending(&t));
+    CHECK(twheel_advance(&w, TEST_SPAN) == 0 && ttimer_pending(&t));
+    twheel_cancel(&w, &t);
+    CHECK(!ttimer_pending(&t) && w.len == 0 && r.fired == 0);
+}
+
+// Checks that missing wheels, timers and functions are rejected. 
+static void test_args(void) {
+    twheel_t w;
+    ttimer_t t;
+    CHECK(twheel_init(NULL, 0) == LLIST_NULL_ERR);
+    CHECK(twheel_init(&w, 0) == LLIST_OK);
+    ttimer_init(&t, NULL, NULL);
+    CHECK(twheel_schedule(&w, &t, 1) == LLIST_NULL_ERR);
+    CHECK(twheel_schedule(&w, NULL, 1) == LLIST_NULL_ERR);
+    CHECK(twheel_schedule(NULL, &t, 1) == LLIST_NULL_ERR);
+    CHECK(!ttimer_pending(NULL) && !ttimer_pending(&t));
+    CHECK(twheel_advance(NULL, 1) == 0);
+    twheel_cancel(&w, NULL);
+    ttimer_init(NULL, NULL, NULL);
+}
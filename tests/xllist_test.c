@@ -0,0 +1,181 @@
+///////////////////////////////////////////////////////////////////////////////
+// xllist_test.c
+// Tests for xllist_t in C99. 
+//
+// Author: agent
+// Date:   17/10/2026
+///////////////////////////////////////////////////////////////////////////////
+
+#include "xllist.h"
+#include "check.h"
+
+#define TEST_LEN 100                        // elements in each test list
+#define TEST_BIG 40                         // size of an out of line element
+
+static void fill(xllist_t *l);
+static bool walks(const xllist_t *l, const size_t *want, size_t n);
+static size_t value(const void *d);
+static void test_add_get(void);
+static void test_ins_del(void);
+static void test_args(void);
+
+int main(void) {
+    test_add_get();
+    test_ins_del();
+    test_args();
+    return check_done("xllist_test");
+}
+
+// Initialises the given XOR linked list and fills it with TEST_LEN elements. 
+// The element at index i starts with i as a size_t, and every third element 
+// is stored out of line. 
+//
+// PARAMS: 
+// l - the XOR linked list to fill
+static void fill(xllist_t *l) {
+    xllist_init(l);
+    unsigned char d[TEST_BIG];
+    for (size_t i = 0; i < TEST_LEN; i++) {
+        memset(d, (int)i, sizeof d);
+        memcpy(d, &i, sizeof i);
+        CHECK(xllist_add(l, d, (i % 3 == 0) ? TEST_BIG : sizeof i) == 
+            LLIST_OK);
+    }
+}
+
+// Returns whether walking an XOR linked list with xllist_step gives the 
+// wanted values from its head, and the same values reversed from its tail. 
+//
+// PARAMS: 
+// l    - the XOR linked list to walk
+// want - the values expected from the head
+// n    - the number of values
+//
+// RET: 
+// True (1) if both walks match, 0 (false) otherwise. 
+static bool walks(const xllist_t *l, const size_t *want, size_t n) {
+    if (l->len != n || (n == 0) != (l->head == NULL || l->tail == NULL))
+        return false;
+    const xlnode_t *prev = NULL;
+    const xlnode_t *cur = l->head;
+    for (size_t i = 0; i < n; i++) {
+        if (cur == NULL || value(xlnode_data(cur)) != want[i])
+            return false;
+        const xlnode_t *next = xllist_step(prev, cur);
+        prev = cur;
+        cur = next;
+    }
+    if (cur != NULL || prev != l->tail)
+        return false;
+
+    prev = NULL;
+    cur = l->tail;
+    for (size_t i = n; i > 0; i--) {
+        if (cur == NULL || value(xlnode_data(cur)) != want[i - 1])
+            return false;
+        const xlnode_t *next = xllist_step(prev, cur);
+        prev = cur;
+        cur = next;
+    }
+    return cur == NULL && prev == l->head;
+}
+
+// Returns the size_t stored at the start of an element. 
+//
+// PARAMS: 
+// d - the element
+//
+// RET: 
+// The value of the element. 
+static size_t value(const void *d) {
+    size_t v = 0;
+    memcpy(&v, d, sizeof v);
+    return v;
+}
+
+// Checks that added elements are copied, walk both ways and are found by 
+// index, and that large elements keep every byte. 
+static void test_add_get(void) {
+    xllist_t l;
+    fill(&l);
+    size_t want[TEST_LEN];
+    for (size_t i = 0; i < TEST_LEN; i++)
+        want[i] = i;
+    CHECK(walks(&l, want, TEST_LEN));
+    for (size_t i = 0; i < TEST_LEN; i++)
+        CHECK(value(xllist_get(&l, i)) == i);
+    CHECK(value(xllist_get(&l, SIZE_MAX)) == TEST_LEN - 1);
+    unsigned char *big = xllist_get(&l, 3);
+    CHECK(big[TEST_BIG - 1] == 3);
+    CHECK((uintptr_t)xllist_get(&l, 1) % LLIST_ARENA_ALIGN == 0);
+    xllist_clear(&l);
+    CHECK(walks(&l, want, 0) && xllist_get(&l, 0) == NULL);
+}
+
+// Checks the XOR links after inserting and deleting at the head, middle and 
+// tail, walking the list both ways after each change. 
+static void test_ins_del(void) {
+    xllist_t l;
+    fill(&l);
+    size_t want[TEST_LEN + 3];
+    size_t n = TEST_LEN;
+    for (size_t i = 0; i < TEST_LEN; i++)
+        want[i] = i;
+
+    size_t v = 1000;                        // insert at head
+    CHECK(xllist_ins(&l, &v, sizeof v, 0) == LLIST_OK);
+    memmove(want + 1, want, n++ * sizeof *want);
+    want[0] = v;
+    CHECK(walks(&l, want, n));
+    v = 1001;                               // insert in the middle
+    CHECK(xllist_ins(&l, &v, sizeof v, n / 2) == LLIST_OK);
+    memmove(want + n / 2 + 1, want + n / 2, (n - n / 2) * sizeof *want);
+    want[n++ / 2] = v;
+    CHECK(walks(&l, want, n));
+    v = 1002;                               // insert past the tail
+    CHECK(xllist_ins(&l, &v, sizeof v, SIZE_MAX) == LLIST_OK);
+    want[n++] = v;
+    CHECK(walks(&l, want, n));
+
+    size_t *d = xllist_del(&l, 0);          // delete the head
+    CHECK(d != NULL && *d == 1000);
+    free(d);
+    memmove(want, want + 1, --n * sizeof *want);
+    CHECK(walks(&l, want, n));
+    unsigned char *big = xllist_del(&l, 3); // an out of line element
+    CHECK(big != NULL && value(big) == 3 && big[TEST_BIG - 1] == 3);
+    free(big);
+    memmove(want + 3, want + 4, (--n - 3) * sizeof *want);
+    CHECK(walks(&l, want, n));
+    d = xllist_del(&l, n / 2);              // delete from the middle
+    CHECK(d != NULL && *d == want[n / 2]);
+    free(d);
+    memmove(want + n / 2, want + n / 2 + 1, (n - n / 2 - 1) * sizeof *want);
+    CHECK(walks(&l, want, --n));
+    d = xllist_del(&l, SIZE_MAX);           // delete the tail
+    CHECK(d != NULL && *d == 1002);
+    free(d);
+    CHECK(walks(&l, want, --n));
+
+    while (l.len > 0)
+        free(xllist_del(&l, 0));
+    CHECK(walks(&l, want, 0));
+    CHECK(xllist_del(&l, 0) == NULL);
+    xllist_clear(&l);
+}
+
+// Checks that invalid arguments are rejected. 
+static void test_args(void) {
+    xllist_t l;
+    size_t v = 1;
+    CHECK(xllist_init(NULL) == LLIST_NULL_ERR);
+    xllist_init(&l);
+    CHECK(xllist_add(NULL, &v, sizeof v) == LLIST_NULL_ERR);
+    CHECK(xllist_add(&l, NULL, sizeof v) == LLIST_NULL_ERR);
+    CHECK(xllist_add(&l, &v, 0) == LLIST_NULL_ERR);
+    CHECK(xllist_ins(&l, &v, 0, 0) == LLIST_NULL_ERR);
+    CHECK(xllist_get(NULL, 0) == NULL);
+    CHECK(xllist_del(NULL, 0) == NULL);
+    CHECK(l.len == 0);
+    xllist_clear(NULL);
+}
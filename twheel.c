@@ -0,0 +1,174 @@
+///////////////////////////////////////////////////////////////////////////////
+// twheel.c
+// Hierarchical timer wheel implementation in C99. Every slot is an intrusive 
+// linked list of timers, so scheduling and cancelling a timer take O(1) time 
+// and never allocate. Timers due further ahead sit on coarser levels, and are 
+// cascaded down a level each time the finer level wraps around. 
+//
+// Author: agent
+// Date:   17/10/2026
+///////////////////////////////////////////////////////////////////////////////
+
+#include "twheel.h"
+
+#define TWHEEL_MASK (TWHEEL_SLOTS - 1)
+
+static void twheel_place(twheel_t *w, ttimer_t *t);
+static void twheel_cascade(twheel_t *w, size_t level);
+
+// Initialises the specified timer, which is not pending. 
+//
+// PARAMS: 
+// t   - the timer to initialise
+// fn  - the function to call when the timer fires
+// ctx - the context passed to fn
+void ttimer_init(ttimer_t *t, void (*fn)(ttimer_t *t, void *ctx), void *ctx) {
+    if (t != NULL) {
+        llist_intrusive_init(&t->link);
+        t->expires = 0;
+        t->fn = fn;
+        t->ctx = ctx;
+    }
+}
+
+// Returns whether the given timer is pending or not. 
+//
+// PARAMS: 
+// t - the timer to check
+//
+// RET: 
+// True (1) if the timer is scheduled and has not fired, 0 (false) otherwise. 
+bool ttimer_pending(const ttimer_t *t) {
+    return (t != NULL && !llist_intrusive_empty(&t->link));
+}
+
+// Initialises the specified timer wheel. 
+//
+// PARAMS: 
+// w   - the timer wheel to initialise
+// now - the current tick
+//
+// RET: 
+// Zero on success, non-zero on error. 
+int twheel_init(twheel_t *w, uint64_t now) {
+    if (w == NULL)
+        return LLIST_NULL_ERR;
+
+    for (size_t i = 0; i < TWHEEL_LEVELS; i++)
+        for (size_t j = 0; j < TWHEEL_SLOTS; j++)
+            llist_intrusive_init(&w->slots[i][j]);
+    w->now = now;
+    w->len = 0;
+    return LLIST_OK;
+}
+
+// Schedules the given timer to fire after a number of ticks. A pending timer 
+// is rescheduled. 
+//
+// PARAMS: 
+// w     - the timer wheel to schedule in
+// t     - the timer to schedule
+// delay - the ticks until the timer fires, at least 1
+//
+// RET: 
+// Zero on success, non-zero on error. 
+int twheel_schedule(twheel_t *w, ttimer_t *t, uint64_t delay) {
+    if (w == NULL || t == NULL || t->fn == NULL)
+        return LLIST_NULL_ERR;
+
+    twheel_cancel(w, t);
+    t->expires = w->now + ((delay == 0) ? 1 : delay);
+    twheel_place(w, t);
+    w->len++;
+    return LLIST_OK;
+}
+
+// Cancels the given timer. Cancelling a timer that is not pending does 
+// nothing. 
+//
+// PARAMS: 
+// w - the timer wheel holding the timer
+// t - the timer to cancel
+void twheel_cancel(twheel_t *w, ttimer_t *t) {
+    if (w != NULL && ttimer_pending(t)) {
+        llist_intrusive_unlink(&t->link);
+        w->len--;
+    }
+}
+
+// Advances the given timer wheel by a number of ticks, firing every timer 
+// that falls due in order of ticks. Timer functions may schedule or cancel 
+// any timer, including their own. 
+//
+// PARAMS: 
+// w     - the timer wheel to advance
+// ticks - the number of ticks to advance
+//
+// RET: 
+// The number of timers fired. 
+size_t twheel_advance(twheel_t *w, uint64_t ticks) {
+    size_t ret = 0;
+    for (uint64_t k = 0; w != NULL && k < ticks; k++) {
+        w->now++;
+        for (size_t i = 1; i < TWHEEL_LEVELS && 
+            (w->now >> (TWHEEL_BITS * (i - 1)) & TWHEEL_MASK) == 0; i++)
+            twheel_cascade(w, i);
+
+        llist_link_t due;                   // detach the slot, then fire
+        llist_intrusive_init(&due);
+        llist_link_t *slot = &w->slots[0][w->now & TWHEEL_MASK];
+        if (!llist_intrusive_empty(slot)) {
+            due.next = slot->next;
+            due.prev = slot->prev;
+            due.next->prev = &due;
+            due.prev->next = &due;
+            llist_intrusive_init(slot);
+        }
+        while (!llist_intrusive_empty(&due)) {
+            ttimer_t *t = LLIST_CONTAINER_OF(due.next, ttimer_t, link);
+            llist_intrusive_unlink(&t->link);
+            w->len--;
+            ret++;
+            t->fn(t, t->ctx);
+        }
+    }
+    return ret;
+}
+
+// Links the given timer into the slot for its expiry. The level is picked by 
+// how far ahead the timer is due, and timers beyond the last level wait in 
+// its furthest slot. 
+//
+// PARAMS: 
+// w - the timer wheel to link the timer in
+// t - the timer to link
+static void twheel_place(twheel_t *w, ttimer_t *t) {
+    uint64_t d = t->expires - w->now;
+    size_t level = 0;
+    while (level < TWHEEL_LEVELS - 1 && 
+        d >= (uint64_t)1 << (TWHEEL_BITS * (level + 1)))
+        level++;
+
+    uint64_t at = t->expires;
+    if (d >> (TWHEEL_BITS * TWHEEL_LEVELS) != 0)    // out of range
+        at = w->now + ((uint64_t)TWHEEL_MASK << (TWHEEL_BITS * level));
+    size_t slot = (size_t)(at >> (TWHEEL_BITS * level)) & TWHEEL_MASK;
+    llist_intrusive_push_back(&w->slots[level][slot], &t->link);
+}
+
+// Moves every timer in the current slot of the given level down to the finer 
+// levels, now that they are due within the span of that level. 
+//
+// PARAMS: 
+// w     - the timer wheel to cascade
+// level - the level to cascade from, at least 1
+static void twheel_cascade(twheel_t *w, size_t level) {
+    size_t idx = (size_t)(w->now >> (TWHEEL_BITS * level)) & TWHEEL_MASK;
+    llist_link_t *slot = &w->slots[level][idx];
+    while (!llist_intrusive_empty(slot)) {
+        ttimer_t *t = LLIST_CONTAINER_OF(slot->next, ttimer_t, link);
+        llist_intrusive_unlink(&t->link);
+        twheel_place(w, t);
+    }
+}
+
@@ -0,0 +1,99 @@
+///////////////////////////////////////////////////////////////////////////////
+// twheel.h
+// Hierarchical timer wheel implementation in C99. Every slot is an intrusive 
+// linked list of timers, so scheduling and cancelling a timer take O(1) time 
+// and never allocate. Timers due further ahead sit on coarser levels, and are 
+// cascaded down a level each time the finer level wraps around. 
+//
+// Author: agent
+// Date:   17/10/2026
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef TWHEEL_H
+#define TWHEEL_H
+#include <stdint.h>
+#include <stdbool.h>
+#include "llist.h"
+#include "llist_intrusive.h"
+
+#define TWHEEL_BITS 8                       // log2 of slots per level
+#define TWHEEL_SLOTS (1u << TWHEEL_BITS)    // slots per level
+#define TWHEEL_LEVELS 4                     // levels, covering 2^32 ticks
+
+// The timer type. Timers are owned by the caller, and linked into the wheel 
+// while pending. 
+typedef struct timer_wheel_timer_t {
+    llist_link_t link;                      // link in the slot
+    uint64_t expires;                       // tick the timer is due
+    void (*fn)(struct timer_wheel_timer_t *t, void *ctx);
+    void *ctx;                              // context passed to fn
+} ttimer_t;
+
+// The hierarchical timer wheel type. 
+typedef struct timer_wheel_t {
+    llist_link_t slots[TWHEEL_LEVELS][TWHEEL_SLOTS];
+    uint64_t now;                           // current tick
+    size_t len;                             // pending timers
+} twheel_t;
+
+// Initialises the specified timer, which is not pending. 
+//
+// PARAMS: 
+// t   - the timer to initialise
+// fn  - the function to call when the timer fires
+// ctx - the context passed to fn
+void ttimer_init(ttimer_t *t, void (*fn)(ttimer_t *t, void *ctx), void *ctx);
+
+// Returns whether the given timer is pending or not. 
+//
+// PARAMS: 
+// t - the timer to check
+//
+// RET: 
+// True (1) if the timer is scheduled and has not fired, 0 (false) otherwise. 
+bool ttimer_pending(const ttimer_t *t);
+
+// Initialises the specified timer wheel. 
+//
+// PARAMS: 
+// w   - the timer wheel to initialise
+// now - the current tick
+//
+// RET: 
+// Zero on success, non-zero on error. 
+int twheel_init(twheel_t *w, uint64_t now);
+
+// Schedules the given timer to fire after a number of ticks. A pending timer 
+// is rescheduled. 
+//
+// PARAMS: 
+// w     - the timer wheel to schedule in
+// t     - the timer to schedule
+// delay - the ticks until the timer fires, at least 1
+//
+// RET: 
+// Zero on success, non-zero on error. 
+int twheel_schedule(twheel_t *w, ttimer_t *t, uint64_t delay);
+
+// Cancels the given timer. Cancelling a timer that is not pending does 
+// nothing. 
+//
+// PARAMS: 
+// w - the timer wheel holding the timer
+// t - the timer to cancel
+void twheel_cancel(twheel_t *w, ttimer_t *t);
+
+// Advances the given timer wheel by a number of ticks, firing every timer 
+// that falls due in order of ticks. Timer functions may schedule or cancel 
+// any timer, including their own. 
+//
+// PARAMS: 
+// w     - the timer wheel to advance
+// ticks - the number of ticks to advance
+//
+// RET: 
+// The number of timers fired. 
+size_t twheel_advance(twheel_t *w, uint64_t ticks);
+
+#endif
+
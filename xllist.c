@@ -0,0 +1,253 @@
+///////////////////////////////////////////////////////////////////////////////
+// xllist.c
+// XOR linked list implementation in C99. Every node stores prev ^ next in a 
+// single link word, so the list can only be walked from its head or tail. 
+//
+// Author: agent
+// Date:   17/10/2026
+///////////////////////////////////////////////////////////////////////////////
+
+#include "xllist.h"
+
+static xlnode_t *xlnode_new(const void *d, size_t n);
+static xlnode_t *xlnode_get(const xllist_t *l, size_t i, xlnode_t **prev);
+static void xlnode_free_whole(xlnode_t *n);
+static void *xlnode_free(xlnode_t *n);
+
+// Initialises the specified XOR linked list. 
+//
+// PARAMS: 
+// l - the XOR linked list to initialise
+//
+// RET: 
+// Zero on success, non-zero on error. 
+int xllist_init(xllist_t *l) {
+    if (l == NULL)
+        return LLIST_NULL_ERR;
+
+    l->head = NULL;
+    l->tail = NULL;
+    l->len = 0;
+    return LLIST_OK;
+}
+
+// Returns the element at the given index in the specified XOR linked list. If 
+// the index is out of range, then the last element will be returned. 
+//
+// PARAMS: 
+// l - the XOR linked list to retrieve the element
+// i - the index of the element
+//
+// RET: 
+// The element at the given index, or NULL if any error occurred. 
+void *xllist_get(const xllist_t *l, size_t i) {
+    xlnode_t *prev = NULL;
+    xlnode_t *node = xlnode_get(l, i, &prev);
+    void *ret = NULL;
+    if (node != NULL)
+        ret = xlnode_data(node);
+    return ret;
+}
+
+// Add a new element into the given XOR linked list. The element will be 
+// stored as a copy. 
+//
+// PARAMS: 
+// l - the XOR linked list to have the element added
+// d - the element to add
+// n - the size of the element
+//
+// RET: 
+// Zero on success, non-zero on error. 
+int xllist_add(xllist_t *l, const void *d, size_t n) {
+    if (l == NULL || d == NULL || n == 0)
+        return LLIST_NULL_ERR;
+
+    xlnode_t *add = xlnode_new(d, n);
+    if (add == NULL)
+        return LLIST_ALLOC_ERR;
+
+    if (l->len == 0) {      // list is empty
+        l->head = add;
+    } else {
+        add->link = (uintptr_t)l->tail;
+        l->tail->link ^= (uintptr_t)add;
+    }
+    l->tail = add;
+    l->len++;
+    return LLIST_OK;
+}
+
+// Inserts a new element into the given XOR linked list. The element will be 
+// stored as a copy. 
+//
+// PARAMS: 
+// l - the XOR linked list to have the element inserted
+// d - the element to insert
+// n - the size of the element
+// i - the index in the XOR linked list to insert to
+//
+// RET: 
+// Zero on success, non-zero on error. 
+int xllist_ins(xllist_t *l, const void *d, size_t n, size_t i) {
+    if (l == NULL || d == NULL || n == 0)
+        return LLIST_NULL_ERR;
+    if (l->len == 0 || i >= l->len)
+        return xllist_add(l, d, n);     // let xllist_add handle out of range
+
+    xlnode_t *ins = xlnode_new(d, n);
+    if (ins == NULL)
+        return LLIST_ALLOC_ERR;
+
+    xlnode_t *bef = NULL;
+    xlnode_t *aft = xlnode_get(l, i, &bef);
+    ins->link = (uintptr_t)bef ^ (uintptr_t)aft;
+    aft->link ^= ((uintptr_t)bef ^ (uintptr_t)ins);
+    if (bef == NULL)        // insert to head
+        l->head = ins;
+    else                    // insert to mid
+        bef->link ^= ((uintptr_t)aft ^ (uintptr_t)ins);
+    l->len++;
+    return LLIST_OK;
+}
+
+// Deletes the element at the given index in the specified XOR linked list. If 
+// the given index is out of range, then the last element will be deleted. The 
+// returned element should be freed by the caller. 
+//
+// PARAMS: 
+// l - the XOR linked list to have the element deleted
+// i - the index of the element
+//
+// RET: 
+// The element that just got removed. 
+void *xllist_del(xllist_t *l, size_t i) {
+    xlnode_t *prev = NULL;
+    xlnode_t *node = xlnode_get(l, i, &prev);   // last if out of range
+    if (node != NULL) {
+        xlnode_t *next = xllist_step(prev, node);
+        if (prev == NULL)
+            l->head = next;
+        else
+            prev->link ^= ((uintptr_t)node ^ (uintptr_t)next);
+        if (next == NULL)
+            l->tail = prev;
+        else
+            next->link ^= ((uintptr_t)node ^ (uintptr_t)prev);
+        l->len--;
+    }
+    return xlnode_free(node);
+}
+
+// Clears the given XOR linked list, removing and freeing every element. 
+//
+// PARAMS: 
+// l - the XOR linked list to free
+void xllist_clear(xllist_t *l) {
+    if (l != NULL && l->len != 0) {
+        xlnode_t *prev = NULL;
+        xlnode_t *current = l->head;
+        while (current != NULL) {
+            xlnode_t *n = current;
+            current = xllist_step(prev, current);
+            prev = n;
+            xlnode_free_whole(n);
+        }
+        l->len = 0;
+        l->head = NULL;
+        l->tail = NULL;
+    }
+}
+
+// Returns a dynamically allocated XOR linked list node. Small elements are 
+// stored inline in the node. 
+//
+// PARAMS: 
+// d - the data in the node
+// n - the size of data
+//
+// RET: 
+// The new node allocated, or NULL if any error occurred. 
+static xlnode_t *xlnode_new(const void *d, size_t n) {
+    xlnode_t *ret = malloc(sizeof *ret);
+    if (ret != NULL) {
+        ret->link = 0;
+        ret->size = n;
+        if (n > LLIST_INLINE_MAX)
+            ret->u.ptr = malloc(n);
+        if (n > LLIST_INLINE_MAX && ret->u.ptr == NULL) {
+            free(ret);
+            ret = NULL;
+        } else {
+            memcpy(xlnode_data(ret), d, n);
+        }
+    }
+    return ret;
+}
+
+// Returns the XOR linked list node at the specified index in the XOR linked 
+// list, along with the node before it. If the index is out of range, the last 
+// node will be returned. 
+//
+// PARAMS: 
+// l    - the XOR linked list to retrieve the node
+// i    - the index of the node
+// prev - where to store the node before the one retrieved
+//
+// RET: 
+// The node retrieved, or NULL if any error occurred. 
+static xlnode_t *xlnode_get(const xllist_t *l, size_t i, xlnode_t **prev) {
+    *prev = NULL;
+    if (l == NULL || l->len == 0)
+        return NULL;
+
+    xlnode_t *ret = NULL;
+    xlnode_t *other = NULL;
+    i = (i >= l->len) ? (l->len - 1) : i;
+    if (i >= l->len / 2) {      // node in upper half, other is next
+        ret = l->tail;
+        for (size_t j = 0; j < (l->len - i - 1); j++) {
+            xlnode_t *n = xllist_step(other, ret);
+            other = ret;
+            ret = n;
+        }
+        *prev = xllist_step(other, ret);
+    } else {                    // node in lower half, other is prev
+        ret = l->head;
+        for (size_t j = 0; j < i; j++) {
+            xlnode_t *n = xllist_step(other, ret);
+            other = ret;
+            ret = n;
+        }
+        *prev = other;
+    }
+    return ret;
+}
+
+// Frees the given XOR linked list node and the element inside. 
+//
+// PARAMS: 
+// n - the node to free
+static void xlnode_free_whole(xlnode_t *n) {
+    if (n != NULL) {
+        if (n->size > LLIST_INLINE_MAX)
+            free(n->u.ptr);
+        free(n);
+    }
+}
+
+// Frees the given XOR linked list node and return the internal element. 
+// Inline elements sit at the start of their node, so the node itself is 
+// returned in place of the element, and the caller frees it as usual. 
+//
+// PARAMS: 
+// n - the node to free
+static void *xlnode_free(xlnode_t *n) {
+    void *ret = NULL;
+    if (n != NULL) {
+        ret = xlnode_data(n);
+        if (n->size > LLIST_INLINE_MAX)
+            free(n);
+    }
+    return ret;
+}
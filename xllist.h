@@ -0,0 +1,127 @@
+///////////////////////////////////////////////////////////////////////////////
+// xllist.h
+// XOR linked list implementation in C99. Every node stores prev ^ next in a 
+// single link word, so the list can only be walked from its head or tail. 
+//
+// Author: agent
+// Date:   17/10/2026
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef XLLIST_H
+#define XLLIST_H
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include "llist.h"
+
+// The XOR linked list node type, laid out as lnode_t was before its nodes 
+// were pooled. Elements up to LLIST_INLINE_MAX bytes are stored inline in 
+// buf, and larger ones behind ptr. Inline storage comes first, where malloc 
+// gives it full alignment, so a deleted inline element is handed back in its 
+// node without being moved. 
+typedef struct xor_linked_list_node_t {
+    union {
+        unsigned char buf[LLIST_INLINE_MAX];    // element, if inline
+        void *ptr;                          // element, if not inline
+    } u;
+    uintptr_t link;                         // address of previous ^ next
+    size_t size;                            // size of internal data
+} xlnode_t;
+
+// The XOR linked list type. 
+typedef struct xor_linked_list_t {
+    xlnode_t *head;                         // list head
+    xlnode_t *tail;                         // list tail
+    size_t len;                             // list size
+} xllist_t;
+
+// Initialises the specified XOR linked list. 
+//
+// PARAMS: 
+// l - the XOR linked list to initialise
+//
+// RET: 
+// Zero on success, non-zero on error. 
+int xllist_init(xllist_t *l);
+
+// Returns the element at the given index in the specified XOR linked list. If 
+// the index is out of range, then the last element will be returned. 
+//
+// PARAMS: 
+// l - the XOR linked list to retrieve the element
+// i - the index of the element
+//
+// RET: 
+// The element at the given index, or NULL if any error occurred. 
+void *xllist_get(const xllist_t *l, size_t i);
+
+// Add a new element into the given XOR linked list. The element will be 
+// stored as a copy. 
+//
+// PARAMS: 
+// l - the XOR linked list to have the element added
+// d - the element to add
+// n - the size of the element
+//
+// RET: 
+// Zero on success, non-zero on error. 
+int xllist_add(xllist_t *l, const void *d, size_t n);
+
+// Inserts a new element into the given XOR linked list. The element will be 
+// stored as a copy. 
+//
+// PARAMS: 
+// l - the XOR linked list to have the element inserted
+// d - the element to insert
+// n - the size of the element
+// i - the index in the XOR linked list to insert to
+//
+// RET: 
+// Zero on success, non-zero on error. 
+int xllist_ins(xllist_t *l, const void *d, size_t n, size_t i);
+
+// Deletes the element at the given index in the specified XOR linked list. If 
+// the given index is out of range, then the last element will be deleted. The 
+// returned element should be freed by the caller. 
+//
+// PARAMS: 
+// l - the XOR linked list to have the element deleted
+// i - the index of the element
+//
+// RET: 
+// The element that just got removed. 
+void *xllist_del(xllist_t *l, size_t i);
+
+// Clears the given XOR linked list, removing and freeing every element. 
+//
+// PARAMS: 
+// l - the XOR linked list to free
+void xllist_clear(xllist_t *l);
+
+// Returns the element stored in the given node, inline or not. 
+//
+// PARAMS: 
+// n - the node holding the element
+//
+// RET: 
+// The element of the node. 
+static inline void *xlnode_data(const xlnode_t *n) {
+    return (n->size <= LLIST_INLINE_MAX) ? (void *)n->u.buf : n->u.ptr;
+}
+
+// Steps through an XOR linked list. Starting with prev as NULL and cur as the 
+// head (or tail), each call returns the node after (or before) cur. 
+//
+// PARAMS: 
+// prev - the node visited before cur
+// cur  - the current node
+//
+// RET: 
+// The next node in the walking direction, or NULL at the end of the list. 
+static inline xlnode_t *xllist_step(const xlnode_t *prev, 
+        const xlnode_t *cur) {
+    return (xlnode_t *)(cur->link ^ (uintptr_t)prev);
+}
+
+#endif
+